@@ -2,16 +2,29 @@ set(headers ${headers}
 	src/Config/Object.h
 	src/Config/ObjectArray.h
 	src/Debug.h
+	src/Game/ClipCache.h
+	src/Game/ConditionWatcher.h
 	src/Game/CreatedObject.h
+	src/Game/HandleBudget.h
 	src/Game/Object.h
+	src/Game/SaveIndex.h
+	src/Game/SaveWriter.h
+	src/Game/SpawnScheduler.h
 	src/Hooks.h
+	src/Log.h
 	src/Manager.h
 	src/PCH.h
 	src/RE.h
+	src/Settings.h
 	src/SharedData.h
+	src/SharedData/ConditionEvaluator.h
+	src/SharedData/ConditionFunctions.h
+	src/SharedData/ConditionGrammar.h
 	src/SharedData/ConditionParser.h
+	src/SharedData/ConditionProgram.h
 	src/SharedData/ExtraData.h
 	src/SharedData/Object.h
 	src/SharedData/Script.h
+	src/SharedData/StaticStringMap.h
 	src/SharedData/Transform.h
 )
@@ -2,13 +2,22 @@ set(sources ${sources}
 	src/Config/Object.cpp
 	src/Config/ObjectArray.cpp
 	src/Debug.cpp
+	src/Game/ClipCache.cpp
+	src/Game/ConditionWatcher.cpp
 	src/Game/CreatedObject.cpp
+	src/Game/HandleBudget.cpp
 	src/Game/Object.cpp
+	src/Game/SaveIndex.cpp
+	src/Game/SaveWriter.cpp
+	src/Game/SpawnScheduler.cpp
 	src/Hooks.cpp
+	src/Log.cpp
 	src/Manager.cpp
 	src/PCH.cpp
 	src/RE.cpp
+	src/Settings.cpp
 	src/SharedData/ConditionParser.cpp
+	src/SharedData/ConditionProgram.cpp
 	src/SharedData/Transform.cpp
 	src/main.cpp
 )
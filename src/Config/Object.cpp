@@ -16,6 +16,11 @@ namespace Config
 		return true;
 	}
 
+	void FilterData::CompileConditions()
+	{
+		compiledConditions = ConditionParser::Compile(conditions);
+	}
+
 	void ObjectData::ReadReferenceFlags(const std::string& input)
 	{
 		static constexpr auto map = clib_util::constexpr_map{ flagArray };
@@ -55,7 +60,7 @@ namespace Config
 					   [&](const std::string& str) {
 						   prefab = Manager::GetSingleton()->GetPrefab(str);
 						   if (!prefab) {
-							   logger::info("Prefab {} not found, skipping object.", str);
+							   Log::config->info("Prefab {} not found, skipping object.", str);
 						   }
 					   } },
 			a_variant);
@@ -100,7 +105,7 @@ namespace Config
 			filter);
 	}
 
-	std::vector<Game::Object> Object::BuildChildObjects(const std::vector<PrefabOrUUID>& a_children, std::size_t a_parentRootHash, const Game::ObjectData& a_parentData)
+	std::vector<Game::Object> Object::BuildChildObjects(const std::vector<PrefabOrUUID>& a_children, std::size_t a_parentRootHash, const Game::ObjectData& a_parentData, bool a_aliasSampling)
 	{
 		using ObjectInstance = Game::Object::Instance;
 
@@ -118,13 +123,16 @@ namespace Config
 				continue;
 			}
 
-			logger::info("\tProcessing child object with prefab {}", childPrefab->uuid);
+			Log::config->info("\tProcessing child object with prefab {}", childPrefab->uuid);
 
 			const std::size_t childHash = hash::combine(a_parentRootHash, childIdx, *childPrefab);
 
 			Game::Object childObject(childPrefab->filter, childPrefab->data);
 			childObject.data.Merge(a_parentData);
 			childObject.bases = childBases;
+			if (a_aliasSampling) {
+				childObject.bases.build_alias_table();
+			}
 
 			auto childFlags = ObjectInstance::GetInstanceFlags(childObject.data, childPrefab->transform, childPrefab->array);
 
@@ -148,10 +156,10 @@ namespace Config
 				childObject.instances.emplace_back(transformRangePtr, childFlags.get(), childHash);
 			}
 
-			logger::info("\t\tGenerated {} instances with {} bases.", childObject.instances.size(), childBases.size());
+			Log::config->info("\t\tGenerated {} instances with {} bases.", childObject.instances.size(), childBases.size());
 
 			if (!childPrefab->children.empty()) {
-				childObject.childObjects = BuildChildObjects(childPrefab->children, childHash, childObject.data);
+				childObject.childObjects = BuildChildObjects(childPrefab->children, childHash, childObject.data, a_aliasSampling);
 			}
 
 			result.push_back(std::move(childObject));
@@ -174,7 +182,7 @@ namespace Config
 			return;
 		}
 
-		logger::info("\tProcessing root object with prefab {}", resolvedPrefab->uuid);
+		Log::config->info("\tProcessing root object with prefab {}", resolvedPrefab->uuid);
 
 		Game::Object      rootObject(filter, resolvedPrefab->data);
 		const std::size_t rootHash = hash::combine(pathHash, a_attachID, GenerateRootHash(), *resolvedPrefab);
@@ -206,20 +214,23 @@ namespace Config
 
 		if (rootObject.instances.empty()) {
 			if (transforms.empty()) {
-				logger::warn("\t[FAIL] No instances generated (zero transforms)");
+				Log::config->warn("\t[FAIL] No instances generated (zero transforms)");
 			} else {
-				logger::warn("\t[FAIL] No instances generated.");
+				Log::config->warn("\t[FAIL] No instances generated.");
 			}
 			return;
 		}
 
-		logger::info("\tGenerated {} instances with {} bases.", rootObject.instances.size(), resolvedBases.size());
+		Log::config->info("\tGenerated {} instances with {} bases.", rootObject.instances.size(), resolvedBases.size());
 
 		if (!resolvedPrefab->children.empty()) {
-			rootObject.childObjects = BuildChildObjects(resolvedPrefab->children, rootHash, rootObject.data);
+			rootObject.childObjects = BuildChildObjects(resolvedPrefab->children, rootHash, rootObject.data, aliasSampling);
 		}
 
 		rootObject.bases = resolvedBases;
+		if (aliasSampling) {
+			rootObject.bases.build_alias_table();
+		}
 		a_objectVec.push_back(std::move(rootObject));
 	}
 
@@ -13,15 +13,18 @@ namespace Config
 {
 	static constexpr REL::Version minConfigVersion{ 1, 0, 0, 0 };
 	static constexpr REL::Version minPrefabVersion{ 1, 0, 0, 0 };
+	static constexpr REL::Version aliasSamplingVersion{ 1, 1, 0, 0 };  // picks weighted bases differently, older configs keep the old picks
 
 	struct FilterData
 	{
 		bool RollChance(std::size_t seed) const;
+		void CompileConditions();
 
-		std::vector<std::string> conditions;
-		std::vector<std::string> whiteList;
-		std::vector<std::string> blackList;
-		float                    chance{ 1.0f };
+		std::vector<std::string>                         conditions;
+		std::vector<std::string>                         whiteList;
+		std::vector<std::string>                         blackList;
+		float                                            chance{ 1.0f };
+		std::shared_ptr<const ConditionParser::Compiled> compiledConditions;  // filled in while reading configs, forms are resolved at data load
 
 	private:
 		GENERATE_HASH(FilterData,
@@ -113,13 +116,14 @@ namespace Config
 	{
 	public:
 		std::size_t                      GenerateRootHash() const;
-		static std::vector<Game::Object> BuildChildObjects(const std::vector<PrefabOrUUID>& a_children, std::size_t a_parentRootHash, const Game::ObjectData& a_parentData);
+		static std::vector<Game::Object> BuildChildObjects(const std::vector<PrefabOrUUID>& a_children, std::size_t a_parentRootHash, const Game::ObjectData& a_parentData, bool a_aliasSampling);
 		void                             CreateGameObject(std::vector<Game::Object>& a_objectVec, const std::variant<RE::RawFormID, std::string_view>& a_attachID) const;
 
 		void SetCurrentPath();
 
 		// members
 		std::size_t                       pathHash;
+		bool                              aliasSampling{ false };
 		PrefabOrUUID                      prefab{};
 		std::vector<RE::BSTransformRange> transforms;  // global
 		ObjectArray                       array;
@@ -147,6 +151,18 @@ namespace Config
 			objectTypes.clear();
 		}
 
+		void SetSamplingMode()
+		{
+			if (version < aliasSamplingVersion) {
+				return;
+			}
+			for (auto* map : { &cells, &objects, &objectTypes }) {
+				for (auto& object : *map | std::views::values | std::views::join) {
+					object.aliasSampling = true;
+				}
+			}
+		}
+
 		// members
 		REL::Version version{ 1, 0, 0, 0 };
 		ObjectMap    cells;
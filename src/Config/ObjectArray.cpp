@@ -109,7 +109,7 @@ namespace Config
 			}
 			auto err = glz::read_file_json(charMap, i->path().string(), buffer);
 			if (err) {
-				logger::error("\tchar error:{}", glz::format_error(err, buffer));
+				Log::config->error("\tchar error:{}", glz::format_error(err, buffer));
 			}
 		}
 	}
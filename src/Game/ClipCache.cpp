@@ -0,0 +1,129 @@
+#include "Game/ClipCache.h"
+
+#include "Game/SaveWriter.h"
+
+namespace Game
+{
+	std::optional<RE::NiPoint3> ClipCache::Find(std::size_t a_hash, const RE::NiPoint3& a_parentPos, const RE::NiPoint3& a_parentRot)
+	{
+		if (const auto it = entries.find(a_hash); it != entries.end() && it->second.parentPos == a_parentPos && it->second.parentRot == a_parentRot) {
+			if (it->second.session != session) {
+				it->second.session = session;
+				dirty = true;
+			}
+			return it->second.translate;
+		}
+		return std::nullopt;
+	}
+
+	void ClipCache::Store(std::size_t a_hash, const RE::NiPoint3& a_parentPos, const RE::NiPoint3& a_parentRot, const RE::NiPoint3& a_translate)
+	{
+		entries.insert_or_assign(a_hash, Entry{ a_parentPos, a_parentRot, a_translate, session });
+		dirty = true;
+	}
+
+	void ClipCache::Load(const std::filesystem::path& a_path, std::size_t a_signature)
+	{
+		SaveWriter::GetSingleton()->Wait();  // a save queued just before may still be writing the file
+
+		entries.clear();
+		signature = a_signature;
+		session = 0;
+		dirty = false;
+
+		std::ifstream file(a_path, std::ios::binary);
+		if (!file) {
+			return;
+		}
+
+		FileHeader header{};
+		if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.magic != magic || header.version != version) {
+			Log::save->info("\tClip cache is unreadable, rebuilding");
+			dirty = true;
+			return;
+		}
+
+		if (header.signature != signature) {
+			Log::save->info("\tConfigs or load order changed, rebuilding clip cache");
+			dirty = true;
+			return;
+		}
+
+		// the count comes from the file, so check it against what is actually there before allocating
+		std::error_code ec;
+		const auto      remaining = std::filesystem::file_size(a_path, ec) - sizeof(header);
+		if (ec || header.count > remaining / sizeof(FileRecord)) {
+			Log::save->info("\tClip cache is truncated, rebuilding");
+			dirty = true;
+			return;
+		}
+
+		std::vector<FileRecord> records(header.count);
+		if (!file.read(reinterpret_cast<char*>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(FileRecord)))) {
+			Log::save->info("\tClip cache is truncated, rebuilding");
+			dirty = true;
+			return;
+		}
+
+		session = header.session + 1;
+		entries.reserve(records.size());
+		for (const auto& record : records) {
+			entries.emplace(record.hash, Entry{ record.parentPos, record.parentRot, record.translate, record.session });
+		}
+
+		Log::save->info("\tLoaded {} cached clip positions", entries.size());
+	}
+
+	void ClipCache::Save(const std::filesystem::path& a_path)
+	{
+		if (!dirty) {
+			return;
+		}
+
+		// entries unused for maxAge sessions are dropped here rather than kept forever
+		erase_if(entries, [this](const auto& a_entry) { return session - a_entry.second.session >= maxAge; });
+
+		std::vector<FileRecord> records;
+		records.reserve(entries.size());
+		for (const auto& [hash, entry] : entries) {
+			records.push_back({ hash, entry.parentPos, entry.parentRot, entry.translate, entry.session });
+		}
+		if (records.size() > maxRecords) {
+			std::ranges::nth_element(records, records.begin() + maxRecords, std::ranges::greater{}, &FileRecord::session);
+			records.resize(maxRecords);
+		}
+
+		const FileHeader header{ magic, version, signature, records.size(), session, 0 };
+
+		SaveWriter::GetSingleton()->Post([a_path, header, records = std::move(records)]() {
+			Write(a_path, header, records);
+		});
+
+		dirty = false;
+	}
+
+	bool ClipCache::Write(const std::filesystem::path& a_path, const FileHeader& a_header, const std::vector<FileRecord>& a_records)
+	{
+		auto tmpPath = a_path;
+		tmpPath += ".tmp";
+
+		{
+			std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+			file.write(reinterpret_cast<const char*>(&a_header), sizeof(a_header));
+			file.write(reinterpret_cast<const char*>(a_records.data()), static_cast<std::streamsize>(a_records.size() * sizeof(FileRecord)));
+			if (!file) {
+				Log::save->info("\tFailed to write clip cache");
+				return false;
+			}
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(tmpPath, a_path, ec);
+		if (ec) {
+			Log::save->info("\tFailed to write clip cache ({})", ec.message());
+			return false;
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+namespace Game
+{
+	// positions corrected by clipping validation, keyed by instance hash
+	// an entry is only reused while the parent reference sits where it did, facing the same way, when the ray was cast
+	// results are persisted between sessions, and discarded wholesale if configs or the load order change
+	// entries not used for a few sessions are dropped on save, and the file never holds more than maxRecords
+	class ClipCache : public REX::Singleton<ClipCache>
+	{
+	public:
+		std::optional<RE::NiPoint3> Find(std::size_t a_hash, const RE::NiPoint3& a_parentPos, const RE::NiPoint3& a_parentRot);
+		void                        Store(std::size_t a_hash, const RE::NiPoint3& a_parentPos, const RE::NiPoint3& a_parentRot, const RE::NiPoint3& a_translate);
+
+		void Load(const std::filesystem::path& a_path, std::size_t a_signature);
+		void Save(const std::filesystem::path& a_path);  // written on the save writer thread
+
+		std::size_t GetSize() const { return entries.size(); }
+
+	private:
+		static constexpr std::uint32_t magic{ 'CPOB' };
+		static constexpr std::uint32_t version{ 3 };
+		static constexpr std::uint32_t maxAge{ 8 };             // sessions an entry survives without being used
+		static constexpr std::size_t   maxRecords{ 1 << 16 };  // most recently used are kept, 3MB at most
+
+		struct Entry
+		{
+			RE::NiPoint3  parentPos;
+			RE::NiPoint3  parentRot;
+			RE::NiPoint3  translate;
+			std::uint32_t session;  // last session it was found or stored in
+		};
+
+		struct FileHeader
+		{
+			std::uint32_t magic;
+			std::uint32_t version;
+			std::uint64_t signature;
+			std::uint64_t count;
+			std::uint32_t session;
+			std::uint32_t reserved;
+		};
+
+		// no padding, every byte written is initialized
+		struct FileRecord
+		{
+			std::uint64_t hash;
+			RE::NiPoint3  parentPos;
+			RE::NiPoint3  parentRot;
+			RE::NiPoint3  translate;
+			std::uint32_t session;
+		};
+		static_assert(sizeof(FileRecord) == sizeof(std::uint64_t) + 3 * sizeof(RE::NiPoint3) + sizeof(std::uint32_t));
+
+		static bool Write(const std::filesystem::path& a_path, const FileHeader& a_header, const std::vector<FileRecord>& a_records);
+
+		// members
+		FlatMap<std::size_t, Entry> entries;
+		std::size_t                 signature{ 0 };
+		std::uint32_t               session{ 0 };
+		bool                        dirty{ false };
+	};
+}
@@ -0,0 +1,172 @@
+#include "Game/ConditionWatcher.h"
+
+#include "Game/SpawnScheduler.h"
+#include "Manager.h"
+#include "Settings.h"
+
+namespace Game
+{
+	bool ConditionWatcher::Placement::IsLoaded() const
+	{
+		if (params.ref) {
+			const auto ref = parentRef.get();
+			if (!ref || ref.get() != params.ref || ref->IsDeleted()) {
+				return false;
+			}
+			const auto cell = ref->GetParentCell();
+			return cell && cell->IsAttached();
+		}
+		return params.cell && params.cell->IsAttached();
+	}
+
+	bool ConditionWatcher::Changes::Affects(const ConditionParser::Dependencies& a_deps) const
+	{
+		if ((time && a_deps.time) || (weather && a_deps.weather)) {
+			return true;
+		}
+		return std::ranges::any_of(a_deps.globals, [&](const auto* a_global) { return globals.contains(a_global); }) ||
+		       std::ranges::any_of(a_deps.quests, [&](const auto a_quest) { return quests.contains(a_quest); });
+	}
+
+	void ConditionWatcher::Register()
+	{
+		const auto holder = RE::ScriptEventSourceHolder::GetSingleton();
+		holder->AddEventSink<RE::TESQuestStageEvent>(this);
+		holder->AddEventSink<RE::TESQuestStartStopEvent>(this);
+	}
+
+	std::size_t ConditionWatcher::GetKey(const Object& a_object, const Object::Params& a_params)
+	{
+		const auto parentID = a_params.ref ? a_params.ref->GetFormID() : a_params.cell->GetFormID();
+		return hash::combine(reinterpret_cast<std::uintptr_t>(&a_object), parentID, a_params.ref ? a_params.refParams.hash : 0);
+	}
+
+	void ConditionWatcher::Watch(const Object& a_object, const Object::Params& a_params, bool a_active)
+	{
+		const auto& deps = a_object.filter.conditionDeps;
+		for (const auto* global : deps.globals) {
+			globalValues.try_emplace(global, static_cast<const RE::TESGlobal*>(global)->value);
+		}
+
+		Placement placement{
+			.object = &a_object,
+			.params = a_params,
+			.parentRef = a_params.ref ? a_params.ref->CreateRefHandle() : RE::ObjectRefHandle(),
+			.active = a_active
+		};
+		placements.insert_or_assign(GetKey(a_object, a_params), std::move(placement));
+	}
+
+	ConditionWatcher::Changes ConditionWatcher::CollectChanges()
+	{
+		Changes changes;
+
+		for (auto& [global, value] : globalValues) {
+			if (const auto current = static_cast<const RE::TESGlobal*>(global)->value; current != value) {
+				value = current;
+				changes.globals.emplace(global);
+			}
+		}
+
+		// time moves constantly, anything reading it is rechecked every poll
+		changes.time = true;
+
+		const auto sky = RE::Sky::GetSingleton();
+		if (const auto weather = sky ? sky->currentWeather : nullptr; weather != lastWeather) {
+			lastWeather = weather;
+			changes.weather = true;
+		}
+
+		{
+			std::scoped_lock lock(questLock);
+			changes.quests.swap(dirtyQuests);
+		}
+
+		return changes;
+	}
+
+	void ConditionWatcher::Update()
+	{
+		if (placements.empty()) {
+			return;
+		}
+
+		const auto interval = Settings::GetSingleton()->GetConditionPollInterval();
+		if (interval.count() == 0) {
+			return;
+		}
+
+		const auto now = clock::now();
+		if (now - lastPoll < interval) {
+			return;
+		}
+		lastPoll = now;
+
+		erase_if(placements, [](const auto& a_entry) { return !a_entry.second.IsLoaded(); });
+
+		const auto changes = CollectChanges();
+
+		// queued after the loop since Enqueue updates the watch list
+		std::vector<std::pair<const Object*, Object::Params>> toSpawn;
+		std::size_t                                           removed = 0;
+
+		for (auto& placement : placements | std::views::values) {
+			const auto& filter = placement.object->filter;
+			if (!changes.Affects(filter.conditionDeps)) {
+				continue;
+			}
+			if (const bool passes = filter.PassesConditions(placement.params.ref); passes != placement.active) {
+				if (passes) {
+					toSpawn.emplace_back(placement.object, placement.params);
+				} else {
+					removed += placement.object->RemoveInstances(Manager::GetSingleton(), placement.params);
+				}
+				placement.active = passes;
+			}
+		}
+
+		if (removed > 0) {
+			Log::spawn->debug("Conditions changed: removed {} objects", removed);
+		}
+
+		if (!toSpawn.empty()) {
+			const auto scheduler = SpawnScheduler::GetSingleton();
+			for (const auto& [object, params] : toSpawn) {
+				scheduler->Enqueue(*object, params);
+			}
+			Log::spawn->debug("Conditions changed: queued {} placements", toSpawn.size());
+		}
+	}
+
+	void ConditionWatcher::Clear()
+	{
+		placements.clear();
+		globalValues.clear();
+		lastWeather = nullptr;
+
+		std::scoped_lock lock(questLock);
+		dirtyQuests.clear();
+	}
+
+	void ConditionWatcher::MarkQuestDirty(RE::FormID a_questID)
+	{
+		std::scoped_lock lock(questLock);
+		dirtyQuests.emplace(a_questID);
+	}
+
+	RE::BSEventNotifyControl ConditionWatcher::ProcessEvent(const RE::TESQuestStageEvent* a_event, RE::BSTEventSource<RE::TESQuestStageEvent>*)
+	{
+		if (a_event) {
+			MarkQuestDirty(a_event->formID);
+		}
+		return RE::BSEventNotifyControl::kContinue;
+	}
+
+	RE::BSEventNotifyControl ConditionWatcher::ProcessEvent(const RE::TESQuestStartStopEvent* a_event, RE::BSTEventSource<RE::TESQuestStartStopEvent>*)
+	{
+		if (a_event) {
+			MarkQuestDirty(a_event->formID);
+		}
+		return RE::BSEventNotifyControl::kContinue;
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Game/Object.h"
+
+namespace Game
+{
+	// rechecks conditional placements at loaded references and cells when the globals, quests, time or weather their conditions read change,
+	// spawning or removing them without waiting for the cell to reload
+	class ConditionWatcher :
+		public REX::Singleton<ConditionWatcher>,
+		public RE::BSTEventSink<RE::TESQuestStageEvent>,
+		public RE::BSTEventSink<RE::TESQuestStartStopEvent>
+	{
+	public:
+		void Register();
+
+		void Watch(const Object& a_object, const Object::Params& a_params, bool a_active);
+		void Update();
+		void Clear();
+
+		std::size_t GetWatchCount() const { return placements.size(); }
+
+	private:
+		using clock = std::chrono::steady_clock;
+
+		struct Placement
+		{
+			bool IsLoaded() const;
+
+			// members
+			const Object*       object;
+			Object::Params      params;
+			RE::ObjectRefHandle parentRef;
+			bool                active;
+		};
+
+		struct Changes
+		{
+			bool empty() const { return globals.empty() && quests.empty() && !time && !weather; }
+			bool Affects(const ConditionParser::Dependencies& a_deps) const;
+
+			// members
+			FlatSet<const RE::TESForm*> globals;
+			FlatSet<RE::FormID>         quests;
+			bool                        time{ false };
+			bool                        weather{ false };
+		};
+
+		static std::size_t GetKey(const Object& a_object, const Object::Params& a_params);
+
+		Changes CollectChanges();
+		void    MarkQuestDirty(RE::FormID a_questID);
+
+		RE::BSEventNotifyControl ProcessEvent(const RE::TESQuestStageEvent* a_event, RE::BSTEventSource<RE::TESQuestStageEvent>*) override;
+		RE::BSEventNotifyControl ProcessEvent(const RE::TESQuestStartStopEvent* a_event, RE::BSTEventSource<RE::TESQuestStartStopEvent>*) override;
+
+		// members
+		FlatMap<std::size_t, Placement>    placements;    // [object + parent, placement]
+		FlatMap<const RE::TESForm*, float> globalValues;  // last polled value of every watched global
+		const RE::TESWeather*              lastWeather{ nullptr };
+		clock::time_point                  lastPoll{};
+		std::mutex                         questLock;
+		FlatSet<RE::FormID>                dirtyQuests;
+	};
+}
@@ -5,7 +5,7 @@
 void CreatedObjects::clear(bool a_deleteObjects)
 {
 	if (a_deleteObjects) {
-		for (auto& [hash, id] : map) {
+		for (const auto& [hash, id] : entries()) {
 			if (const auto ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(id); Manager::GetSerializedObjectHash(ref) == hash) {
 				RE::GarbageCollector::GetSingleton()->Add(ref, true);
 			}
@@ -15,11 +15,33 @@ void CreatedObjects::clear(bool a_deleteObjects)
 	clear();
 }
 
+void CreatedObjects::emplace(std::size_t a_hash, RE::FormID a_id)
+{
+	if (find(a_hash) == a_id && a_id != 0) {
+		return;
+	}
+
+	// the new pair wins, either key's old pairing is stale
+	erase(a_hash);
+	erase(a_id);
+
+	hashes.push_back(a_hash);
+	ids.push_back(a_id);
+
+	// keep both indexes at most three quarters full
+	if (hashes.size() * 4 > hashIndex.size() * 3) {
+		rebuild_index();
+	} else {
+		const auto slot = static_cast<std::uint32_t>(hashes.size());
+		hashIndex[index_find(hashIndex, hashes, a_hash)] = slot;
+		idIndex[index_find(idIndex, ids, a_id)] = slot;
+	}
+}
+
 bool CreatedObjects::erase(RE::FormID a_formID)
 {
-	if (auto it = inverseMap.find(a_formID); it != inverseMap.end()) {
-		map.erase(it->second);
-		inverseMap.erase(it);
+	if (const auto pos = index_find(idIndex, ids, a_formID); pos != npos && idIndex[pos] != 0) {
+		erase_slot(idIndex[pos] - 1);
 		return true;
 	}
 	return false;
@@ -27,9 +49,8 @@ bool CreatedObjects::erase(RE::FormID a_formID)
 
 bool CreatedObjects::erase(std::size_t a_hash)
 {
-	if (auto it = map.find(a_hash); it != map.end()) {
-		inverseMap.erase(it->second);
-		map.erase(it);
+	if (const auto pos = index_find(hashIndex, hashes, a_hash); pos != npos && hashIndex[pos] != 0) {
+		erase_slot(hashIndex[pos] - 1);
 		return true;
 	}
 	return false;
@@ -37,21 +58,276 @@ bool CreatedObjects::erase(std::size_t a_hash)
 
 RE::FormID CreatedObjects::find(std::size_t a_hash) const
 {
-	auto it = map.find(a_hash);
-	return it != map.end() ? it->second : 0;
+	const auto pos = index_find(hashIndex, hashes, a_hash);
+	return pos != npos && hashIndex[pos] != 0 ? ids[hashIndex[pos] - 1] : 0;
 }
 
 std::size_t CreatedObjects::find(RE::FormID a_formID) const
 {
-	auto it = inverseMap.find(a_formID);
-	return it != inverseMap.end() ? it->second : 0;
+	const auto pos = index_find(idIndex, ids, a_formID);
+	return pos != npos && idIndex[pos] != 0 ? hashes[idIndex[pos] - 1] : 0;
+}
+
+void CreatedObjects::rebuild_index()
+{
+	std::size_t capacity = 16;
+	while (capacity * 3 < hashes.size() * 4) {
+		capacity <<= 1;
+	}
+
+	hashIndex.assign(capacity, 0);
+	idIndex.assign(capacity, 0);
+
+	// later duplicates of either key are dropped
+	std::uint32_t kept = 0;
+	for (std::size_t slot = 0; slot < hashes.size(); ++slot) {
+		hashes[kept] = hashes[slot];
+		ids[kept] = ids[slot];
+		const auto hashPos = index_find(hashIndex, hashes, hashes[kept]);
+		const auto idPos = index_find(idIndex, ids, ids[kept]);
+		if (hashIndex[hashPos] == 0 && idIndex[idPos] == 0) {
+			hashIndex[hashPos] = ++kept;
+			idIndex[idPos] = kept;
+		}
+	}
+	hashes.resize(kept);
+	ids.resize(kept);
+}
+
+void CreatedObjects::erase_slot(std::size_t a_slot)
+{
+	index_erase(hashIndex, hashes, index_find(hashIndex, hashes, hashes[a_slot]));
+	index_erase(idIndex, ids, index_find(idIndex, ids, ids[a_slot]));
+
+	// the last slot fills the gap so the arrays stay dense
+	if (const auto last = hashes.size() - 1; a_slot != last) {
+		const auto slot = static_cast<std::uint32_t>(a_slot + 1);
+		hashIndex[index_find(hashIndex, hashes, hashes[last])] = slot;
+		idIndex[index_find(idIndex, ids, ids[last])] = slot;
+		hashes[a_slot] = hashes[last];
+		ids[a_slot] = ids[last];
+	}
+	hashes.pop_back();
+	ids.pop_back();
+}
+
+void CreatedObjects::assign(const Snapshot& a_snapshot)
+{
+	clear();
+
+	version = a_snapshot.version;
+	hashes.reserve(a_snapshot.entries.size());
+	ids.reserve(a_snapshot.entries.size());
+	for (const auto& [hash, numericID] : a_snapshot.entries) {
+		// refs from plugins no longer loaded resolve to 0 and would be respawned anyway
+		if (const auto id = numericID.GetNumericID(); id != 0) {
+			hashes.push_back(hash);
+			ids.push_back(id);
+		}
+	}
+	rebuild_index();
+}
+
+CreatedObjects::Snapshot CreatedObjects::snapshot() const
+{
+	Snapshot snapshot{ .version = version };
+	snapshot.entries.reserve(size());
+	for (const auto& [hash, formID] : entries()) {
+		snapshot.entries.emplace_back(hash, RE::BGSNumericIDIndex{}).second.SetNumericID(formID);
+	}
+	return snapshot;
+}
+
+void CreatedObjects::Snapshot::sort()
+{
+	std::ranges::sort(entries, {}, &Entry::first);
+}
+
+CreatedObjects::File CreatedObjects::File::Diff(const Snapshot& a_base, std::vector<std::uint64_t> a_chunks, const Snapshot& a_current)
+{
+	File file{ .chunks = std::move(a_chunks), .version = a_current.version };
+
+	// both sides are sorted by hash, so one merge pass finds every change
+	auto base = a_base.entries.begin();
+	auto current = a_current.entries.begin();
+	while (base != a_base.entries.end() || current != a_current.entries.end()) {
+		if (current == a_current.entries.end() || (base != a_base.entries.end() && base->first < current->first)) {
+			file.removals.push_back(base->first);
+			++base;
+		} else if (base == a_base.entries.end() || current->first < base->first) {
+			file.upserts.push_back(*current);
+			++current;
+		} else {
+			if (!(base->second == current->second)) {
+				file.upserts.push_back(*current);
+			}
+			++base;
+			++current;
+		}
+	}
+
+	return file;
+}
+
+std::filesystem::path CreatedObjects::File::GetChunkPath(const std::filesystem::path& a_dir, std::uint64_t a_chunkID)
+{
+	return a_dir / "Chunks" / std::format("{:016X}.bop", a_chunkID);
 }
 
-void CreatedObjects::rebuild_inverse_map()
+std::uint64_t CreatedObjects::File::GetChunkID(std::span<const Entry> a_entries)
 {
-	inverseMap.clear();
-	inverseMap.reserve(map.size());
-	for (const auto& [hash, id] : map) {
-		inverseMap.emplace(id, hash);
+	std::uint64_t id = 0;
+	for (const auto& [hash, numericID] : a_entries) {
+		id = hash::combine(id, hash, numericID);
+	}
+	return std::max<std::uint64_t>(id, 1);
+}
+
+CreatedObjects::Snapshot CreatedObjects::File::Apply(const Snapshot& a_base) const
+{
+	Snapshot snapshot{ .version = version };
+	snapshot.entries.reserve(a_base.entries.size() + upserts.size());
+
+	auto removal = removals.begin();
+	auto upsert = upserts.begin();
+	for (const auto& entry : a_base.entries) {
+		while (upsert != upserts.end() && upsert->first < entry.first) {
+			snapshot.entries.push_back(*upsert++);
+		}
+		while (removal != removals.end() && *removal < entry.first) {
+			++removal;
+		}
+		if (upsert != upserts.end() && upsert->first == entry.first) {
+			snapshot.entries.push_back(*upsert++);
+		} else if (removal == removals.end() || *removal != entry.first) {
+			snapshot.entries.push_back(entry);
+		}
+	}
+	snapshot.entries.insert(snapshot.entries.end(), upsert, upserts.end());
+
+	return snapshot;
+}
+
+bool CreatedObjects::File::Read(const std::filesystem::path& a_path, bool a_headerOnly)
+{
+	std::ifstream file(a_path, std::ios::binary);
+	if (!file) {
+		return false;
+	}
+
+	FileHeader header{};
+	if (!file.read(reinterpret_cast<char*>(&header), offsetof(FileHeader, chunkCount)) || header.magic != fileMagic) {
+		Log::save->info("\tUnrecognised file format");
+		return false;
+	}
+
+	switch (header.fileVersion) {
+	case 1:  // whole map only, with a single count
+		file.read(reinterpret_cast<char*>(&header.upsertCount), sizeof(header.upsertCount));
+		break;
+	case 2:  // a single base ID instead of a chunk count
+	case fileVersion:
+		file.read(reinterpret_cast<char*>(&header.chunkCount), sizeof(header) - offsetof(FileHeader, chunkCount));
+		break;
+	default:
+		Log::save->info("\tUnrecognised file version {}", header.fileVersion);
+		return false;
+	}
+	if (!file) {
+		Log::save->info("\tFile is truncated");
+		return false;
+	}
+
+	// counts are checked against what's left of the file before anything is sized from them
+	std::error_code ec;
+	const auto      fileSize = std::filesystem::file_size(a_path, ec);
+	std::uint64_t   remaining = ec ? 0 : fileSize - static_cast<std::uint64_t>(file.tellg());
+	const auto      take = [&](std::uint64_t a_count, std::size_t a_size) {
+		if (a_count > remaining / a_size) {
+			return false;
+		}
+		remaining -= a_count * a_size;
+		return true;
+	};
+
+	chunks.clear();
+	if (header.fileVersion == fileVersion) {
+		if (!take(header.chunkCount, sizeof(std::uint64_t))) {
+			Log::save->info("\tChunk count {} doesn't fit the file", header.chunkCount);
+			return false;
+		}
+		chunks.resize(header.chunkCount);
+		file.read(reinterpret_cast<char*>(chunks.data()), static_cast<std::streamsize>(chunks.size() * sizeof(std::uint64_t)));
+	} else if (header.fileVersion == 2 && header.chunkCount != 0) {
+		chunks.push_back(header.chunkCount);
+	}
+
+	version = REL::Version::unpack(header.version);
+	if (!file || a_headerOnly) {
+		return static_cast<bool>(file);
+	}
+
+	if (!take(header.upsertCount, sizeof(std::uint64_t) + sizeof(RE::BGSNumericIDIndex)) || !take(header.removalCount, sizeof(std::uint64_t))) {
+		Log::save->info("\tEntry counts {}+{} don't fit the file", header.upsertCount, header.removalCount);
+		return false;
+	}
+
+	std::vector<std::uint64_t>         hashes(header.upsertCount);
+	std::vector<RE::BGSNumericIDIndex> ids(header.upsertCount);
+	removals.resize(header.removalCount);
+
+	file.read(reinterpret_cast<char*>(hashes.data()), static_cast<std::streamsize>(hashes.size() * sizeof(std::uint64_t)));
+	file.read(reinterpret_cast<char*>(ids.data()), static_cast<std::streamsize>(ids.size() * sizeof(RE::BGSNumericIDIndex)));
+	file.read(reinterpret_cast<char*>(removals.data()), static_cast<std::streamsize>(removals.size() * sizeof(std::uint64_t)));
+	if (!file) {
+		Log::save->info("\tFile is truncated");
+		return false;
+	}
+
+	upserts.clear();
+	upserts.reserve(hashes.size());
+	for (std::size_t i = 0; i < hashes.size(); ++i) {
+		upserts.emplace_back(hashes[i], ids[i]);
+	}
+
+	return true;
+}
+
+bool CreatedObjects::File::Write(const std::filesystem::path& a_path) const
+{
+	std::vector<std::uint64_t>         hashes;
+	std::vector<RE::BGSNumericIDIndex> ids;
+	hashes.reserve(upserts.size());
+	ids.reserve(upserts.size());
+	for (const auto& [hash, id] : upserts) {
+		hashes.push_back(hash);
+		ids.push_back(id);
+	}
+
+	const FileHeader header{ fileMagic, fileVersion, version.pack(), 0, chunks.size(), upserts.size(), removals.size() };
+
+	auto tmpPath = a_path;
+	tmpPath += ".tmp";
+
+	bool written = false;
+	{
+		std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		file.write(reinterpret_cast<const char*>(chunks.data()), static_cast<std::streamsize>(chunks.size() * sizeof(std::uint64_t)));
+		file.write(reinterpret_cast<const char*>(hashes.data()), static_cast<std::streamsize>(hashes.size() * sizeof(std::uint64_t)));
+		file.write(reinterpret_cast<const char*>(ids.data()), static_cast<std::streamsize>(ids.size() * sizeof(RE::BGSNumericIDIndex)));
+		file.write(reinterpret_cast<const char*>(removals.data()), static_cast<std::streamsize>(removals.size() * sizeof(std::uint64_t)));
+		file.close();
+		written = static_cast<bool>(file);
+	}
+
+	std::error_code ec;
+	if (written) {
+		std::filesystem::rename(tmpPath, a_path, ec);
+	}
+	if (!written || ec) {
+		std::filesystem::remove(tmpPath, ec);  // a failed write leaves nothing behind
+		return false;
 	}
+	return true;
 }
@@ -0,0 +1,34 @@
+#include "Game/HandleBudget.h"
+
+namespace Game
+{
+	void HandleBudget::Sample(bool a_force)
+	{
+		const auto now = clock::now();
+		if (!a_force && sampled && now - lastSample < resampleInterval) {
+			return;
+		}
+
+		count = RE::GetNumReferenceHandles();
+		lastSample = now;
+		sampled = true;
+	}
+
+	bool HandleBudget::Reserve()
+	{
+		auto current = count.load();
+		do {
+			if (current >= maxHandles) {
+				return false;
+			}
+		} while (!count.compare_exchange_weak(current, current + 1));
+
+		return true;
+	}
+
+	void HandleBudget::Release()
+	{
+		auto current = count.load();
+		while (current > 0 && !count.compare_exchange_weak(current, current - 1)) {}
+	}
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+namespace Game
+{
+	// keeps a running count of reference handles so spawning doesn't walk the entire handle manager per call
+	// the count is resampled at most once per frame and updated incrementally as objects are created/deleted
+	class HandleBudget : public REX::Singleton<HandleBudget>
+	{
+	public:
+		static constexpr std::uint32_t maxHandles{ 1000000 };
+
+		void Sample(bool a_force = false);
+
+		bool Reserve();
+		void Release();
+
+		std::uint32_t GetCount() const { return count; }
+
+	private:
+		using clock = std::chrono::steady_clock;
+
+		static constexpr auto resampleInterval{ 16ms };
+
+		// members
+		std::atomic<std::uint32_t> count{ 0 };
+		clock::time_point          lastSample{};
+		bool                       sampled{ false };
+	};
+}
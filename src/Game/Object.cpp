@@ -1,104 +1,121 @@
 #include "Game/Object.h"
 
 #include "Config/Object.h"
+#include "Game/ClipCache.h"
+#include "Game/HandleBudget.h"
+#include "Game/SpawnScheduler.h"
 #include "Manager.h"
 
 Game::ObjectFilter::Input::Input(RE::TESObjectREFR* a_ref, RE::TESObjectCELL* a_cell) :
 	ref(a_ref),
 	baseObj(a_ref ? a_ref->GetBaseObject() : nullptr),
 	cell(a_cell),
-	fileName(a_ref ? a_ref->GetFile(0)->fileName : ""sv)
+	file(a_ref ? a_ref->GetFile(0) : nullptr)
 {}
 
-Game::ObjectFilter::ObjectFilter(const Config::FilterData& a_filter)
+void Game::ObjectFilter::List::Add(const std::vector<std::string>& a_filters)
 {
-	AddTo(whiteList, a_filter.whiteList);
-	AddTo(blackList, a_filter.blackList);
-}
+	const auto dataHandler = RE::TESDataHandler::GetSingleton();
 
-bool Game::ObjectFilter::IsAllowed(RE::TESObjectREFR* a_ref, RE::TESObjectCELL* a_cell) const
-{
-	if (blackList.empty() && whiteList.empty()) {
-		return true;
-	}
-
-	const Input input(a_ref, a_cell);
-
-	if (CheckList(blackList, input)) {
-		return false;
-	}
-	if (!whiteList.empty() && !CheckList(whiteList, input)) {
-		return false;
-	}
-	return true;
-}
-
-void Game::ObjectFilter::AddTo(std::vector<FilterEntry>& a_filters, const std::vector<std::string>& a_otherFilters)
-{
-	a_filters.reserve(a_otherFilters.size());
-	for (const auto& str : a_otherFilters) {
+	formIDs.reserve(a_filters.size());
+	for (const auto& str : a_filters) {
 		if (const auto formID = RE::GetRawFormID(str, true)) {
 			if (const auto list = RE::TESForm::LookupByID<RE::BGSListForm>(formID.id)) {
 				list->ForEachForm([&](auto* form) {
-					a_filters.emplace_back(form->GetFormID());
+					formIDs.emplace(form->GetFormID());
 					return RE::BSContainer::ForEachResult::kContinue;
 				});
 			} else {
-				a_filters.emplace_back(formID.id);
+				formIDs.emplace(formID.id);
 			}
+		} else if (const auto file = dataHandler->LookupModByName(str)) {
+			if (file->IsLight()) {
+				lightPlugins.set(file->GetSmallFileCompileIndex());
+			} else {
+				plugins.set(file->GetCompileIndex());
+			}
+			hasPlugins = true;
 		} else {
-			a_filters.emplace_back(str);
+			cellIDs.emplace(str);
 		}
 	}
 }
 
-bool Game::ObjectFilter::CheckList(const std::vector<FilterEntry>& a_list, const Input& input)
+bool Game::ObjectFilter::List::Match(const Input& a_input) const
 {
-	for (const auto& entry : a_list) {
-		bool matched = false;
-		std::visit(overload{
-					   [&](RE::FormID a_id) {
-						   matched = MatchFormID(a_id, input);
-					   },
-					   [&](const std::string& a_str) {
-						   matched = MatchString(a_str, input);
-					   } },
-			entry);
-		if (matched) {
+	if (!formIDs.empty()) {
+		if ((a_input.ref && formIDs.contains(a_input.ref->GetFormID())) ||
+			(a_input.baseObj && formIDs.contains(a_input.baseObj->GetFormID())) ||
+			(a_input.cell && formIDs.contains(a_input.cell->GetFormID()))) {
 			return true;
 		}
 	}
-	return false;
+
+	if (hasPlugins && a_input.file) {
+		if (a_input.file->IsLight() ? lightPlugins.test(a_input.file->GetSmallFileCompileIndex()) : plugins.test(a_input.file->GetCompileIndex())) {
+			return true;
+		}
+	}
+
+	return !cellIDs.empty() && a_input.cell && cellIDs.contains(std::string_view(a_input.cell->GetFormEditorID()));
 }
 
-bool Game::ObjectFilter::MatchFormID(RE::FormID a_id, const Input& input)
+Game::ObjectFilter::ObjectFilter(const Config::FilterData& a_filter)
 {
-	return (input.ref && input.ref->GetFormID() == a_id) || (input.baseObj && input.baseObj->GetFormID() == a_id) || (input.cell && input.cell->GetFormID() == a_id);
+	whiteList.Add(a_filter.whiteList);
+	blackList.Add(a_filter.blackList);
 }
 
-bool Game::ObjectFilter::MatchString(const std::string& a_str, const Input& input)
+bool Game::ObjectFilter::IsAllowed(RE::TESObjectREFR* a_ref, RE::TESObjectCELL* a_cell) const
 {
-	return a_str == input.fileName || input.cell && a_str == input.cell->GetFormEditorID();
+	if (blackList.empty() && whiteList.empty()) {
+		return true;
+	}
+
+	const Input input(a_ref, a_cell);
+
+	if (blackList.Match(input)) {
+		return false;
+	}
+	if (!whiteList.empty() && !whiteList.Match(input)) {
+		return false;
+	}
+	return true;
 }
 
 Game::FilterData::FilterData(const Config::FilterData& a_filter) :
-	conditions(ConditionParser::BuildCondition(a_filter.conditions)),
+	conditions(a_filter.compiledConditions ? ConditionParser::BuildCondition(*a_filter.compiledConditions) : ConditionParser::BuildCondition(a_filter.conditions)),
+	conditionProgram(conditions ? ConditionProgram(*conditions) : ConditionProgram()),
+	conditionScope(conditions ? ConditionParser::GetScope(*conditions) : ConditionParser::Scope::kGlobal),
+	conditionDeps(conditions ? ConditionParser::GetDependencies(*conditions) : ConditionParser::Dependencies()),
 	filter(a_filter)
 {}
 
 bool Game::FilterData::PassesFilters(RE::TESObjectREFR* a_ref, RE::TESObjectCELL* a_cell) const
 {
-	if (!filter.IsAllowed(a_ref, a_cell)) {
-		return false;
+	return filter.IsAllowed(a_ref, a_cell) && PassesConditions(a_ref);
+}
+
+bool Game::FilterData::PassesConditions(RE::TESObjectREFR* a_ref) const
+{
+	if (!conditions) {
+		return true;
 	}
 
-	if (conditions) {
-		if (auto conditionRef = a_ref ? a_ref : RE::PlayerCharacter::GetSingleton(); !conditions->IsTrue(conditionRef, conditionRef)) {
-			return false;
-		}
+	const auto conditionRef = a_ref ? a_ref : RE::PlayerCharacter::GetSingleton();
+
+	// cell placements always run on the player
+	const bool cacheable = conditionScope == ConditionParser::Scope::kGlobal || (!a_ref && conditionScope == ConditionParser::Scope::kSubject);
+	if (!cacheable) {
+		return conditionProgram.Evaluate(conditionRef);
 	}
 
-	return true;
+	if (const auto frame = SpawnScheduler::GetSingleton()->GetFrame(); cachedFrame != frame) {
+		cachedResult = conditionProgram.Evaluate(conditionRef);
+		cachedFrame = frame;
+	}
+
+	return cachedResult;
 }
 
 Game::ObjectData::ObjectData(const Config::ObjectData& a_data) :
@@ -134,9 +151,9 @@ void Game::ObjectData::Merge(const Game::ObjectData& a_parent)
 	}
 }
 
-bool Game::ObjectData::PreventClipping(const RE::TESBoundObject* a_base) const
+bool Game::ObjectData::PreventClipping(const Base::BoundData& a_bounds) const
 {
-	return flags.any(ReferenceFlags::kPreventClipping) || (motionType.type == RE::hkpMotion::MotionType::kKeyframed || motionType.type == RE::hkpMotion::MotionType::kFixed || !RE::CanBeMoved(a_base));
+	return flags.any(ReferenceFlags::kPreventClipping) || (motionType.type == RE::hkpMotion::MotionType::kKeyframed || motionType.type == RE::hkpMotion::MotionType::kFixed || !a_bounds.canBeMoved);
 }
 
 void Game::ObjectData::SetProperties(RE::TESObjectREFR* a_ref, std::size_t a_hash) const
@@ -205,92 +222,23 @@ void Game::ObjectData::AttachScripts(RE::TESObjectREFR* a_ref) const
 		return;
 	}
 
-	for (const auto& [scriptName, properties, autoFill] : scripts) {
+	autoFillPlans.resize(scripts.size());
+
+	for (const auto& [script, autoFillPlan] : std::views::zip(scripts, autoFillPlans)) {
 		RE::BSTSmartPointer<RE::BSScript::Object> objectPtr;
-		if (!vm->CreateObject(scriptName, objectPtr) || !objectPtr) {
+		if (!vm->CreateObject(script.script, objectPtr) || !objectPtr) {
 			continue;
 		}
 
-		StringSet manualProperties;
+		script.BindProperties(objectPtr.get(), vm, bindPolicy);
 
-		if (!properties.empty()) {
-			for (auto& [propName, property] : properties) {
-				auto propInfo = objectPtr->GetProperty(propName);
-				if (!propInfo) {
-					continue;
-				}
-				std::visit(overload{
-							   [&](std::monostate) {},
-							   [&](const RE::BSFixedString& a_val) {
-								   propInfo->SetString(a_val);
-							   },
-							   [&](const RE::TESForm* a_val) {
-								   RE::BSTSmartPointer<RE::BSScript::Object> obj;
-								   RE::VMHandle                              a_handle = handlePolicy->GetHandleForObject(a_val->GetFormType(), a_val);
-								   if (a_handle && vm->CreateObject(scriptName, obj) && obj) {
-									   if (bindPolicy) {
-										   bindPolicy->BindObject(obj, a_handle);
-										   propInfo->SetObject(obj);
-									   }
-								   }
-							   },
-							   [&](const std::int32_t& a_val) {
-								   propInfo->SetSInt(a_val);
-							   },
-							   [&](const float& a_val) {
-								   propInfo->SetFloat(a_val);
-							   },
-							   [&](const bool& a_val) {
-								   propInfo->SetBool(a_val);
-							   },
-							   [&](const std::vector<RE::TESForm*>& a_val) {
-								   CreateScriptArray(scriptName, propInfo, a_val);
-							   },
-							   [&](const std::vector<std::string>& a_val) {
-								   CreateScriptArray(scriptName, propInfo, a_val);
-							   },
-							   [&](const std::vector<std::int32_t>& a_val) {
-								   CreateScriptArray(scriptName, propInfo, a_val);
-							   },
-							   [&](const std::vector<float>& a_val) {
-								   CreateScriptArray(scriptName, propInfo, a_val);
-							   },
-							   [&](const std::vector<bool>& a_val) {
-								   CreateScriptArray(scriptName, propInfo, a_val);
-							   } },
-					property);
-				manualProperties.emplace(propName);
+		if (script.autoFillProperties) {
+			if (!autoFillPlan) {
+				autoFillPlan = BuildAutoFillPlan(script, objectPtr.get(), handlePolicy);
 			}
-		}
-
-		if (autoFill) {
-			if (const auto typeInfo = objectPtr->GetTypeInfo()) {
-				auto* scriptProperties = typeInfo->GetPropertyIter();
-				for (std::uint32_t i = 0; i < typeInfo->propertyCount; i++) {
-					auto& [propertyName, propertyInfo] = scriptProperties[i];
-
-					if (manualProperties.contains(propertyName)) {
-						continue;
-					}
-
-					auto* form = RE::TESForm::LookupByEditorID(propertyName);
-					if (!form) {
-						continue;
-					}
-
-					auto* propertyVariable = objectPtr->GetProperty(propertyName);
-					if (!propertyVariable || !propertyVariable->IsObject()) {
-						continue;
-					}
-
-					RE::VMHandle                              propHandle = handlePolicy->GetHandleForObject(form->GetFormType(), form);
-					RE::BSTSmartPointer<RE::BSScript::Object> propObject;
-					if (propHandle && vm->CreateObject(scriptName, propObject) && propObject) {
-						if (bindPolicy) {
-							bindPolicy->BindObject(propObject, propHandle);
-							propertyVariable->SetObject(propObject);
-						}
-					}
+			for (const auto& [propertyName, form, propHandle] : autoFillPlan->entries) {
+				if (auto* propertyVariable = objectPtr->GetProperty(propertyName)) {
+					script.BindHandle(propertyVariable, propHandle, vm, bindPolicy);
 				}
 			}
 		}
@@ -306,6 +254,61 @@ void Game::ObjectData::AttachScripts(RE::TESObjectREFR* a_ref) const
 	}
 }
 
+Game::AutoFillPlan Game::ObjectData::BuildAutoFillPlan(const BSScript::Script<BSScript::GameValue>& a_script, RE::BSScript::Object* a_object, RE::BSScript::IObjectHandlePolicy* a_handlePolicy)
+{
+	AutoFillPlan plan;
+
+	const auto typeInfo = a_object->GetTypeInfo();
+	if (!typeInfo) {
+		return plan;
+	}
+
+	auto* scriptProperties = typeInfo->GetPropertyIter();
+	for (std::uint32_t i = 0; i < typeInfo->propertyCount; i++) {
+		auto& [propertyName, propertyInfo] = scriptProperties[i];
+
+		if (std::ranges::contains(a_script.properties | std::views::keys, propertyName)) {  // set manually
+			continue;
+		}
+
+		auto* form = RE::TESForm::LookupByEditorID(propertyName);
+		if (!form) {
+			continue;
+		}
+
+		auto* propertyVariable = a_object->GetProperty(propertyName);
+		if (!propertyVariable || !propertyVariable->IsObject()) {
+			continue;
+		}
+
+		if (const auto handle = a_handlePolicy->GetHandleForObject(form->GetFormType(), form)) {
+			plan.entries.emplace_back(propertyName, form, handle);
+		}
+	}
+
+	logger::info("\tResolved {} autofill properties for {}", plan.entries.size(), a_script.script.c_str());
+
+	return plan;
+}
+
+Game::SpawnContext::SpawnContext(bool a_forceHandleSample) :
+	dataHandler(RE::TESDataHandler::GetSingleton()),
+	mgr(Manager::GetSingleton()),
+	handles(HandleBudget::GetSingleton()),
+	scheduler(SpawnScheduler::GetSingleton()),
+	clipCache(ClipCache::GetSingleton())
+{
+	handles->Sample(a_forceHandleSample);
+}
+
+RE::ClipRaycaster& Game::SpawnContext::GetRaycaster(RE::TESObjectCELL* a_cell, RE::TESObjectREFR* a_ref, const RE::BoundingBox& a_refBB) const
+{
+	if (!raycaster || !raycaster->IsFor(a_ref)) {
+		raycaster.emplace(a_cell, a_ref, a_refBB);
+	}
+	return *raycaster;
+}
+
 Game::Object::Params::RefParams::RefParams(RE::TESObjectREFR* a_ref, std::size_t a_parentHash) :
 	hash(a_parentHash == 0 ? hash::combine(RE::RawFormID(a_ref->GetFormID())) : a_parentHash),
 	bb(a_ref)
@@ -387,94 +390,198 @@ bool Game::Object::IsTemporary() const
 	return data.flags.any(ReferenceFlags::kTemporary) || filter.conditions != nullptr;
 }
 
-void Game::Object::SpawnObject(RE::TESDataHandler* a_dataHandler, Manager* a_mgr, const Params& a_params, std::uint32_t& a_numHandles, const std::vector<Object>& a_childObjects) const
+std::pair<std::size_t, std::uint32_t> Game::Object::ResolveInstance(std::size_t a_idx, bool a_hasRef, std::size_t a_refHash) const
 {
-	auto [refParams, ref, cell, worldSpace] = a_params;
-	auto [refHash, bb] = refParams;
+	const auto& instance = instances[a_idx];
+	const auto  baseSize = static_cast<std::uint32_t>(bases.size());
 
-	if (!filter.PassesFilters(a_params.ref, a_params.cell)) {
-		return;
+	auto hash = instance.hash;
+	if (a_hasRef) {
+		hash = hash::combine(instance.hash, a_refHash);
 	}
 
-	const auto baseSize = static_cast<std::uint32_t>(bases.size());
-	bool       isTemporary = IsTemporary();
+	std::uint32_t baseIndex = 0;
+	if (instance.flags.any(Instance::Flags::kSequentialObjects)) {
+		baseIndex = static_cast<std::uint32_t>(a_idx % baseSize);
+	} else if (bases.flags.any(Base::WeightedObjects<RE::TESBoundObject*>::Flags::kEqualWeights)) {
+		baseIndex = clib_util::RNG(hash).generate<std::uint32_t>(0, baseSize - 1);
+	} else if (bases.flags.any(Base::WeightedObjects<RE::TESBoundObject*>::Flags::kAliasTable)) {
+		baseIndex = bases.sample_alias(hash);
+	} else {
+		baseIndex = static_cast<std::uint32_t>(clib_util::WeightedRNG(hash, bases.weights).generate());
+	}
 
-	for (auto&& [idx, instance] : std::views::enumerate(instances)) {
-		auto hash = instance.hash;
-		if (ref) {
-			hash = hash::combine(instance.hash, refHash);
-		}
+	return { hash::combine(hash, baseIndex), baseIndex };
+}
 
-		std::uint32_t baseIndex = 0;
-		if (instance.flags.any(Instance::Flags::kSequentialObjects)) {
-			baseIndex = static_cast<std::uint32_t>(idx % baseSize);
-		} else if (bases.flags.any(Base::WeightedObjects<RE::TESBoundObject*>::Flags::kEqualWeights)) {
-			baseIndex = clib_util::RNG(hash).generate<std::uint32_t>(0, baseSize - 1);
-		} else {
-			baseIndex = static_cast<std::uint32_t>(clib_util::WeightedRNG(hash, bases.weights).generate());
+std::size_t Game::Object::RemoveInstances(Manager* a_mgr, const Params& a_params) const
+{
+	return RemoveInstances(a_mgr, a_params.ref != nullptr, a_params.refParams.hash);
+}
+
+std::size_t Game::Object::RemoveInstances(Manager* a_mgr, bool a_hasRef, std::size_t a_refHash) const
+{
+	std::size_t count = 0;
+
+	for (std::size_t idx = 0; idx < instances.size(); ++idx) {
+		const auto hash = ResolveInstance(idx, a_hasRef, a_refHash).first;
+		for (const auto& childObject : childObjects) {
+			count += childObject.RemoveInstances(a_mgr, true, hash);
 		}
+		if (const auto id = a_mgr->GetSavedObject(hash); id != 0) {
+			if (const auto ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(id); ref && a_mgr->IsTempObject(ref)) {
+				a_mgr->ClearTempObject(ref);
+				count++;
+			}
+		}
+	}
 
-		hash = hash::combine(hash, baseIndex);
-		a_mgr->AddConfigObject(hash, this);
+	return count;
+}
 
-		if (auto id = a_mgr->GetSavedObject(hash); id != 0) {
-			logger::info("\t[{:X}]{:X} already exists, skipping spawn.", hash, id);
-			continue;
+Game::Object::SpawnResult Game::Object::SpawnInstance(const SpawnContext& a_ctx, const Params& a_params, std::size_t a_idx) const
+{
+	auto [refParams, ref, cell, worldSpace] = a_params;
+	auto [refHash, bb] = refParams;
+
+	const auto& instance = instances[a_idx];
+	const auto [hash, baseIndex] = ResolveInstance(a_idx, ref != nullptr, refHash);
+
+	a_ctx.mgr->AddConfigObject(hash, this);
+
+	if (auto id = a_ctx.mgr->GetSavedObject(hash); id != 0) {
+		Log::spawn->debug("\t[{:X}]{:X} already exists, skipping spawn.", hash, id);
+		// children are separate jobs and may have been dropped when this unloaded, they skip themselves if they exist
+		if (const auto existingRef = RE::TESForm::LookupByID<RE::TESObjectREFR>(id); existingRef && existingRef->GetParentCell()) {
+			EnqueueChildren(a_ctx, existingRef, hash);
 		}
+		return SpawnResult::kExists;
+	}
 
-		if (a_numHandles >= 1000000 || (a_dataHandler->nextID & 0xFFFFFF) >= 0x3FFFFF) {  // max id reached
-			logger::info("\t[{:X}] Maximum number of handles/FF formIDs reached. Skipping.", hash);
-			continue;
+	if ((a_ctx.dataHandler->nextID & 0xFFFFFF) >= 0x3FFFFF || !a_ctx.handles->Reserve()) {  // max id reached
+		Log::spawn->debug("\t[{:X}] Maximum number of handles/FF formIDs reached. Skipping.", hash);
+		return SpawnResult::kLimitReached;
+	}
+
+	const auto  baseObject = bases.objects[baseIndex];
+	const auto& baseBounds = bases.bounds[baseIndex];
+	auto        transform = instance.GetWorldTransform(bb.pos, bb.rot, hash);
+	if (ref && data.PreventClipping(baseBounds)) {
+		if (const auto translate = a_ctx.clipCache->Find(hash, bb.pos, bb.rot)) {
+			transform.translate = *translate;
+		} else if (a_ctx.GetRaycaster(cell, ref, bb).ValidatePosition(transform, baseBounds.extents)) {
+			a_ctx.clipCache->Store(hash, bb.pos, bb.rot, transform.translate);
 		}
+	}
 
-		a_numHandles++;
-
-		const auto baseObject = bases.objects[baseIndex];
-		auto       transform = instance.GetWorldTransform(bb.pos, bb.rot, hash);
-		if (ref && data.PreventClipping(baseObject)) {
-			RE::NiPoint3 baseObjectExtents{
-				static_cast<float>(baseObject->boundData.boundMax.x - baseObject->boundData.boundMin.x),
-				static_cast<float>(baseObject->boundData.boundMax.y - baseObject->boundData.boundMin.y),
-				static_cast<float>(baseObject->boundData.boundMax.z - baseObject->boundData.boundMin.z)
-			};
-			transform.ValidatePosition(cell, ref, bb, baseObjectExtents);
+	auto createdRefHandle = a_ctx.dataHandler->CreateReferenceAtLocation(
+		baseObject,
+		transform.translate,
+		transform.rotate,
+		cell,
+		worldSpace,
+		nullptr,
+		nullptr,
+		{},
+		false,
+		true);
+
+	auto createdRef = createdRefHandle.get();
+	if (!createdRef) {
+		a_ctx.handles->Release();
+		return SpawnResult::kFailed;
+	}
+
+	if (float scale = transform.scale; scale != 1.0f) {
+		if (instance.flags.any(Instance::Flags::kRelativeScale)) {
+			scale *= bb.scale;
 		}
+		createdRef->SetScale(scale);
+		createdRef->AddChange(RE::TESObjectREFR::ChangeFlags::kScale);
+	}
 
-		auto createdRefHandle = a_dataHandler->CreateReferenceAtLocation(
-			baseObject,
-			transform.translate,
-			transform.rotate,
-			cell,
-			worldSpace,
-			nullptr,
-			nullptr,
-			{},
-			false,
-			true);
-
-		if (auto createdRef = createdRefHandle.get()) {
-			if (float scale = transform.scale; scale != 1.0f) {
-				if (instance.flags.any(Instance::Flags::kRelativeScale)) {
-					scale *= bb.scale;
-				}
-				createdRef->SetScale(scale);
-				createdRef->AddChange(RE::TESObjectREFR::ChangeFlags::kScale);
-			}
+	data.SetProperties(createdRef.get(), hash);
 
-			data.SetProperties(createdRef.get(), hash);
+	a_ctx.mgr->SerializeObject(hash, createdRef, IsTemporary());
 
-			a_mgr->SerializeObject(hash, createdRef, isTemporary);
+	Log::spawn->debug("\tSpawning object {:X} with hash {:X}.", createdRef->GetFormID(), hash);
 
-			logger::info("\tSpawning object {:X} with hash {:X}.", createdRef->GetFormID(), hash);
+	EnqueueChildren(a_ctx, createdRef.get(), hash);
 
-			if (!a_childObjects.empty()) {
-				const Params createdParams(createdRef.get(), hash);
-				for (const auto& childObject : a_childObjects) {
-					childObject.SpawnObject(a_dataHandler, a_mgr, createdParams, a_numHandles, childObject.childObjects);
-				}
-			}
+	return SpawnResult::kSpawned;
+}
+
+void Game::Object::EnqueueChildren(const SpawnContext& a_ctx, RE::TESObjectREFR* a_ref, std::size_t a_hash) const
+{
+	if (childObjects.empty()) {
+		return;
+	}
+
+	const Params params(a_ref, a_hash);
+	for (const auto& childObject : childObjects) {
+		a_ctx.scheduler->Enqueue(childObject, params);
+	}
+}
+
+void Game::ReferenceIndex::clear()
+{
+	refIDs.clear();
+	baseIDs.clear();
+	baseTypes.clear();
+	scanAllReferences = false;
+}
+
+void Game::ReferenceIndex::Build(const FormIDObjectMap& a_objects, const FormTypeObjectMap& a_objectTypes)
+{
+	clear();
+
+	for (const auto& [attachID, objectVec] : a_objects) {
+		if (objectVec.empty()) {
+			continue;
 		}
+		std::visit(overload{
+					   [&](RE::FormID a_id) {
+						   // unresolved IDs can only be temporary references that aren't loaded yet
+						   const auto form = RE::TESForm::LookupByID(a_id);
+						   if (!form || form->AsReference()) {
+							   refIDs.emplace(a_id);
+						   } else {
+							   baseIDs.emplace(a_id);
+						   }
+					   },
+					   [&](const std::string& a_edid) {
+						   if (const auto form = RE::TESForm::LookupByEditorID(a_edid)) {
+							   if (!form->AsReference()) {
+								   baseIDs.emplace(form->GetFormID());
+							   }
+						   } else {
+							   scanAllReferences = true;
+						   }
+					   } },
+			attachID);
+	}
+
+	for (const auto& [formType, objectVec] : a_objectTypes) {
+		if (!objectVec.empty()) {
+			baseTypes.emplace(formType);
+		}
+	}
+}
+
+bool Game::ReferenceIndex::IsCandidate(const RE::TESObjectREFR* a_ref, const RE::TESBoundObject* a_base) const
+{
+	if (scanAllReferences || refIDs.contains(a_ref->GetFormID())) {
+		return true;
 	}
+	return a_base && (baseIDs.contains(a_base->GetFormID()) || baseTypes.contains(a_base->GetFormType()));
+}
+
+void Game::Format::BuildIndex()
+{
+	referenceIndex.Build(objects, objectTypes);
+
+	logger::info("Indexed {} references, {} base objects and {} form types{}", referenceIndex.refIDs.size(), referenceIndex.baseIDs.size(), referenceIndex.baseTypes.size(),
+		referenceIndex.scanAllReferences ? " (unresolved editorIDs found, scanning all references)" : "");
 }
 
 std::vector<Game::Object>* Game::Format::FindObjects(const RE::TESObjectREFR* a_ref, const RE::TESBoundObject* a_base)
@@ -506,43 +613,77 @@ std::vector<Game::Object>* Game::Format::FindObjects(const RE::TESBoundObject* a
 	return nullptr;
 }
 
-void Game::Format::SpawnInCell(RE::TESObjectCELL* a_cell)
+void Game::Format::SpawnInLoadedArea()
+{
+	const SpawnContext ctx(true);
+
+	const bool placeInCells = !cells.empty();
+	const bool scanReferences = (!objects.empty() || !objectTypes.empty()) && referenceIndex.RequiresReferenceScan();
+
+	if (!scanReferences) {
+		// only placements attached to specific references, look them up directly
+		for (const auto& refID : referenceIndex.refIDs) {
+			if (const auto ref = RE::TESForm::LookupByID<RE::TESObjectREFR>(refID); ref && !ref->IsDynamicForm()) {
+				if (const auto cell = ref->GetParentCell(); cell && cell->IsAttached()) {
+					SpawnAtReference(ref, ctx);
+				}
+			}
+		}
+	}
+
+	if (!scanReferences && !placeInCells) {
+		return;
+	}
+
+	RE::TES::GetSingleton()->ForEachCell([&](auto* cell) {
+		if (scanReferences) {
+			cell->ForEachReference([&](auto* ref) {
+				if (!ref->IsDynamicForm()) {
+					SpawnAtReference(ref, ctx);
+				}
+				return RE::BSContainer::ForEachResult::kContinue;
+			});
+		}
+		if (placeInCells) {
+			SpawnInCell(cell, ctx);
+		}
+	});
+}
+
+void Game::Format::SpawnInCell(RE::TESObjectCELL* a_cell, const SpawnContext& a_ctx)
 {
 	if (const auto it = cells.find(a_cell->GetFormEditorID()); it != cells.end()) {
-		const auto           mgr = Manager::GetSingleton();
-		const auto           dataHandler = RE::TESDataHandler::GetSingleton();
 		const Object::Params objectParams(a_cell);
-		auto                 numHandles = RE::GetNumReferenceHandles();
 		for (const auto& object : it->second) {
-			object.SpawnObject(dataHandler, mgr, objectParams, numHandles, object.childObjects);
+			a_ctx.scheduler->Enqueue(object, objectParams);
 		}
 	}
 }
 
-void Game::Format::SpawnAtReference(RE::TESObjectREFR* a_ref)
+void Game::Format::SpawnAtReference(RE::TESObjectREFR* a_ref, const SpawnContext& a_ctx)
 {
 	if (objects.empty() && objectTypes.empty()) {
 		return;
 	}
 
 	const auto base = a_ref->GetBaseObject();
+	if (!referenceIndex.IsCandidate(a_ref, base)) {
+		return;
+	}
 
 	const auto objectsToSpawn = FindObjects(a_ref, base);
 	const auto objectsToSpawnFromTypes = FindObjects(base);
 
 	if (objectsToSpawn || objectsToSpawnFromTypes) {
-		const auto           mgr = Manager::GetSingleton();
-		const auto           dataHandler = RE::TESDataHandler::GetSingleton();
 		const Object::Params params(a_ref, 0);
-		auto                 numHandles = RE::GetNumReferenceHandles();
 		if (objectsToSpawn) {
 			for (const auto& object : *objectsToSpawn) {
-				object.SpawnObject(dataHandler, mgr, params, numHandles, object.childObjects);
+				a_ctx.scheduler->Enqueue(object, params);
 			}
 		}
 		if (objectsToSpawnFromTypes) {
 			for (const auto& object : *objectsToSpawnFromTypes) {
-				object.SpawnObject(dataHandler, mgr, params, numHandles, object.childObjects);
+				a_ctx.scheduler->Enqueue(object, params);
 			}
 		}
 	}
@@ -4,6 +4,13 @@
 
 class Manager;
 
+namespace Game
+{
+	class ClipCache;
+	class HandleBudget;
+	class SpawnScheduler;
+}
+
 namespace Config
 {
 	struct ObjectArray;
@@ -16,10 +23,9 @@ namespace Game
 {
 	using ReferenceFlags = Base::ReferenceFlags;
 
+	// white/blacklists compiled into sets and bitsets, so checks cost a few probes regardless of list length
 	struct ObjectFilter
 	{
-		using FilterEntry = std::variant<RE::FormID, std::string>;
-
 		struct Input
 		{
 			Input() = default;
@@ -29,7 +35,22 @@ namespace Game
 			RE::TESObjectREFR*  ref;
 			RE::TESBoundObject* baseObj;
 			RE::TESObjectCELL*  cell;
-			std::string_view    fileName;
+			const RE::TESFile*  file;
+		};
+
+		struct List
+		{
+			bool empty() const { return formIDs.empty() && cellIDs.empty() && !hasPlugins; }
+
+			void Add(const std::vector<std::string>& a_filters);
+			bool Match(const Input& a_input) const;
+
+			// members
+			FlatSet<RE::FormID> formIDs;       // refs, bases, cells and expanded formlists
+			std::bitset<256>    plugins;       // by compile index
+			std::bitset<4096>   lightPlugins;  // by small file compile index
+			StringSet           cellIDs;
+			bool                hasPlugins{ false };
 		};
 
 		ObjectFilter() = default;
@@ -38,15 +59,8 @@ namespace Game
 		bool IsAllowed(RE::TESObjectREFR* a_ref, RE::TESObjectCELL* a_cell) const;
 
 		// members
-		std::vector<FilterEntry> whiteList;
-		std::vector<FilterEntry> blackList;
-
-	private:
-		static void AddTo(std::vector<FilterEntry>& a_filters, const std::vector<std::string>& a_otherFilters);
-
-		static bool CheckList(const std::vector<FilterEntry>& a_list, const Input& input);
-		static bool MatchFormID(RE::FormID a_id, const Input& input);
-		static bool MatchString(const std::string& a_str, const Input& input);
+		List whiteList;
+		List blackList;
 	};
 
 	struct FilterData
@@ -55,10 +69,33 @@ namespace Game
 		explicit FilterData(const Config::FilterData& a_filter);
 
 		bool PassesFilters(RE::TESObjectREFR* a_ref, RE::TESObjectCELL* a_cell) const;
+		bool PassesConditions(RE::TESObjectREFR* a_ref) const;
+
+		// members
+		std::shared_ptr<const RE::TESCondition> conditions;
+		ConditionProgram                        conditionProgram;
+		ConditionParser::Scope                  conditionScope{ ConditionParser::Scope::kGlobal };
+		ConditionParser::Dependencies           conditionDeps;
+		ObjectFilter                            filter;
+
+	private:
+		// members
+		mutable std::uint64_t cachedFrame{ std::numeric_limits<std::uint64_t>::max() };  // results that don't depend on the subject are reused within a frame
+		mutable bool          cachedResult{ false };
+	};
+
+	// autofilled properties only depend on the script and its config entry, so they're resolved once on first attach
+	struct AutoFillPlan
+	{
+		struct Entry
+		{
+			RE::BSFixedString property;
+			RE::TESForm*      form;
+			RE::VMHandle      handle;
+		};
 
 		// members
-		std::unique_ptr<RE::TESCondition> conditions;
-		ObjectFilter                      filter;
+		std::vector<Entry> entries;
 	};
 
 	struct ObjectData
@@ -68,7 +105,7 @@ namespace Game
 
 		void Merge(const Game::ObjectData& a_parent);
 
-		bool PreventClipping(const RE::TESBoundObject* a_base) const;
+		bool PreventClipping(const Base::BoundData& a_bounds) const;
 
 		void SetProperties(RE::TESObjectREFR* a_ref, std::size_t a_hash) const;
 		void SetPropertiesHavok(RE::TESObjectREFR* a_ref, RE::NiAVObject* a_root) const;
@@ -83,54 +120,27 @@ namespace Game
 		void SetPropertiesFlags(RE::TESObjectREFR* a_ref) const;
 		void AttachScripts(RE::TESObjectREFR* a_ref) const;
 
-		template <class U>
-		static void CreateScriptArray(std::string_view scriptName, RE::BSScript::Variable* a_variable, const std::vector<U>& a_val)
-		{
-			auto* vm = RE::BSScript::Internal::VirtualMachine::GetSingleton();
-			auto* handlePolicy = vm->GetObjectHandlePolicy();
-			auto* bindPolicy = vm->GetObjectBindPolicy();
-
-			RE::BSTSmartPointer<RE::BSScript::Array> arr;
-
-			RE::BSScript::TypeInfo typeInfo;
-			if constexpr (std::is_same_v<U, RE::TESForm*>) {
-				typeInfo = RE::BSScript::TypeInfo::RawType::kObject;
-			} else if constexpr (std::is_same_v<U, std::string>) {
-				typeInfo = RE::BSScript::TypeInfo::RawType::kString;
-			} else if constexpr (std::is_same_v<U, std::int32_t>) {
-				typeInfo = RE::BSScript::TypeInfo::RawType::kInt;
-			} else if constexpr (std::is_same_v<U, float>) {
-				typeInfo = RE::BSScript::TypeInfo::RawType::kFloat;
-			} else if constexpr (std::is_same_v<U, bool>) {
-				typeInfo = RE::BSScript::TypeInfo::RawType::kBool;
-			}
-
-			vm->CreateArray(typeInfo, static_cast<std::uint32_t>(a_val.size()), arr);
-
-			for (std::uint32_t i = 0; i < a_val.size(); i++) {
-				if constexpr (std::is_same_v<U, RE::TESForm*>) {
-					auto                                      form = a_val[i];
-					RE::BSTSmartPointer<RE::BSScript::Object> obj;
-					RE::VMHandle                              handle = handlePolicy->GetHandleForObject(form->GetFormType(), form);
-					if (handle && vm->CreateObject(scriptName, obj) && obj) {
-						if (bindPolicy) {
-							bindPolicy->BindObject(obj, handle);
-							arr->data()[i].SetObject(obj);
-						}
-					}
-				} else if constexpr (std::is_same_v<U, std::string>) {
-					arr->data()[i].SetString(a_val[i]);
-				} else if constexpr (std::is_same_v<U, std::int32_t>) {
-					arr->data()[i].SetSInt(a_val[i]);
-				} else if constexpr (std::is_same_v<U, float>) {
-					arr->data()[i].SetFloat(a_val[i]);
-				} else if constexpr (std::is_same_v<U, bool>) {
-					arr->data()[i].SetBool(a_val[i]);
-				}
-			}
-
-			a_variable->SetArray(arr);
-		}
+		static AutoFillPlan BuildAutoFillPlan(const BSScript::Script<BSScript::GameValue>& a_script, RE::BSScript::Object* a_object, RE::BSScript::IObjectHandlePolicy* a_handlePolicy);
+
+		// members
+		mutable std::vector<std::optional<AutoFillPlan>> autoFillPlans;  // parallel to scripts, built lazily
+	};
+
+	// per-batch state shared by every spawn in that batch
+	struct SpawnContext
+	{
+		explicit SpawnContext(bool a_forceHandleSample = false);
+
+		// reused while consecutive instances share a parent
+		RE::ClipRaycaster& GetRaycaster(RE::TESObjectCELL* a_cell, RE::TESObjectREFR* a_ref, const RE::BoundingBox& a_refBB) const;
+
+		// members
+		RE::TESDataHandler*                      dataHandler;
+		Manager*                                 mgr;
+		HandleBudget*                            handles;
+		SpawnScheduler*                          scheduler;
+		ClipCache*                               clipCache;
+		mutable std::optional<RE::ClipRaycaster> raycaster;
 	};
 
 	class Object
@@ -144,7 +154,7 @@ namespace Game
 				RefParams(RE::TESObjectREFR* a_ref, std::size_t a_parentHash);
 
 				// members
-				std::size_t     hash;
+				std::size_t     hash{ 0 };
 				RE::BoundingBox bb;
 			};
 
@@ -185,12 +195,21 @@ namespace Game
 			std::size_t                           hash;
 		};
 
+		enum class SpawnResult
+		{
+			kSpawned,
+			kExists,
+			kLimitReached,
+			kFailed
+		};
+
 		Object() = default;
 		explicit Object(const Config::FilterData& a_filter, const Config::ObjectData& a_data);
 
 		bool IsTemporary() const;
 
-		void SpawnObject(RE::TESDataHandler* a_dataHandler, Manager* a_mgr, const Params& a_params, std::uint32_t& a_numHandles, const std::vector<Object>& a_childObjects) const;
+		SpawnResult SpawnInstance(const SpawnContext& a_ctx, const Params& a_params, std::size_t a_idx) const;
+		std::size_t RemoveInstances(Manager* a_mgr, const Params& a_params) const;
 
 		// members
 		ObjectData                                 data;
@@ -198,12 +217,35 @@ namespace Game
 		Base::WeightedObjects<RE::TESBoundObject*> bases;
 		std::vector<Instance>                      instances;
 		std::vector<Object>                        childObjects;
+
+	private:
+		// final hash and chosen base of an instance, the same every time that placement is spawned
+		std::pair<std::size_t, std::uint32_t> ResolveInstance(std::size_t a_idx, bool a_hasRef, std::size_t a_refHash) const;
+
+		std::size_t RemoveInstances(Manager* a_mgr, bool a_hasRef, std::size_t a_refHash) const;
+		void        EnqueueChildren(const SpawnContext& a_ctx, RE::TESObjectREFR* a_ref, std::size_t a_hash) const;
 	};
 
 	using FormIDObjectMap = FlatMap<std::variant<RE::FormID, std::string>, std::vector<Game::Object>>;
 	using EditorIDObjectMap = StringMap<std::vector<Game::Object>>;
 	using FormTypeObjectMap = FlatMap<RE::FormType, std::vector<Game::Object>>;
 
+	// narrows down which references can have placements, so loaded area scans can skip everything else
+	struct ReferenceIndex
+	{
+		void clear();
+		void Build(const FormIDObjectMap& a_objects, const FormTypeObjectMap& a_objectTypes);
+
+		bool IsCandidate(const RE::TESObjectREFR* a_ref, const RE::TESBoundObject* a_base) const;
+		bool RequiresReferenceScan() const { return scanAllReferences || !baseIDs.empty() || !baseTypes.empty(); }
+
+		// members
+		FlatSet<RE::FormID>   refIDs;
+		FlatSet<RE::FormID>   baseIDs;
+		FlatSet<RE::FormType> baseTypes;
+		bool                  scanAllReferences{ false };  // editorIDs that can't be resolved at load
+	};
+
 	struct Format
 	{
 		void clear()
@@ -211,17 +253,22 @@ namespace Game
 			cells.clear();
 			objects.clear();
 			objectTypes.clear();
+			referenceIndex.clear();
 		}
 
+		void BuildIndex();
+
 		std::vector<Game::Object>* FindObjects(const RE::TESObjectREFR* a_ref, const RE::TESBoundObject* a_base);
 		std::vector<Game::Object>* FindObjects(const RE::TESBoundObject* a_base);
 
-		void SpawnInCell(RE::TESObjectCELL* a_cell);
-		void SpawnAtReference(RE::TESObjectREFR* a_ref);
+		void SpawnInLoadedArea();
+		void SpawnInCell(RE::TESObjectCELL* a_cell, const SpawnContext& a_ctx);
+		void SpawnAtReference(RE::TESObjectREFR* a_ref, const SpawnContext& a_ctx);
 
 		// members
 		EditorIDObjectMap cells;
 		FormIDObjectMap   objects;
 		FormTypeObjectMap objectTypes;
+		ReferenceIndex    referenceIndex;
 	};
 }
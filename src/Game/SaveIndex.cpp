@@ -0,0 +1,221 @@
+#include "Game/SaveIndex.h"
+
+#include "Game/CreatedObject.h"
+
+namespace Game
+{
+	bool SaveIndex::Load(const std::filesystem::path& a_dir)
+	{
+		dir = a_dir;
+		files.clear();
+		chunkRefs.clear();
+
+		std::ifstream file(dir / fileName, std::ios::binary);
+		if (!file) {
+			return false;
+		}
+
+		std::uint32_t fileMagic = 0;
+		std::uint32_t fileVersion = 0;
+		std::uint64_t count = 0;
+		file.read(reinterpret_cast<char*>(&fileMagic), sizeof(fileMagic));
+		file.read(reinterpret_cast<char*>(&fileVersion), sizeof(fileVersion));
+		file.read(reinterpret_cast<char*>(&count), sizeof(count));
+		if (!file || fileMagic != magic || fileVersion != version) {
+			return false;
+		}
+
+		// lengths are checked against what's left of the file before anything is sized from them
+		std::error_code ec;
+		const auto      fileSize = std::filesystem::file_size(dir / fileName, ec);
+		std::uint64_t   remaining = ec ? 0 : fileSize - static_cast<std::uint64_t>(file.tellg());
+		const auto      take = [&](std::uint64_t a_count, std::size_t a_size) {
+			if (a_count > remaining / a_size) {
+				return false;
+			}
+			remaining -= a_count * a_size;
+			return true;
+		};
+
+		for (std::uint64_t i = 0; i < count; ++i) {
+			std::uint32_t nameLength = 0;
+			file.read(reinterpret_cast<char*>(&nameLength), sizeof(nameLength));
+			if (!file || !take(1, sizeof(nameLength)) || !take(nameLength, 1)) {
+				files.clear();
+				chunkRefs.clear();
+				return false;
+			}
+			std::string name(nameLength, '\0');
+			file.read(name.data(), nameLength);
+
+			std::uint32_t chunkCount = 0;
+			file.read(reinterpret_cast<char*>(&chunkCount), sizeof(chunkCount));
+			if (!file || !take(1, sizeof(chunkCount)) || !take(chunkCount, sizeof(std::uint64_t))) {
+				files.clear();
+				chunkRefs.clear();
+				return false;
+			}
+			std::vector<std::uint64_t> chunks(chunkCount);
+			file.read(reinterpret_cast<char*>(chunks.data()), static_cast<std::streamsize>(chunks.size() * sizeof(std::uint64_t)));
+
+			if (!file) {
+				files.clear();
+				chunkRefs.clear();
+				return false;
+			}
+
+			AddRefs(chunks);
+			files.insert_or_assign(std::move(name), std::move(chunks));
+		}
+
+		loaded = true;
+		return true;
+	}
+
+	void SaveIndex::Rebuild(const std::filesystem::path& a_dir)
+	{
+		dir = a_dir;
+		files.clear();
+		chunkRefs.clear();
+
+		std::error_code ec;
+
+		// version 2 bases are single chunks under the old folder name
+		if (const auto bases = dir / "Bases"; std::filesystem::exists(bases, ec)) {
+			const auto chunkDir = CreatedObjects::File::GetChunkPath(dir, 0).parent_path();
+			std::filesystem::create_directories(chunkDir, ec);
+			for (const auto& entry : std::filesystem::directory_iterator(bases, ec)) {
+				std::filesystem::rename(entry.path(), chunkDir / entry.path().filename(), ec);
+			}
+			std::filesystem::remove_all(bases, ec);
+		}
+
+		for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+			// temporary files of sidecars or the index itself left behind by an interrupted write
+			if (entry.path().extension() == ".tmp"sv) {
+				std::filesystem::remove(entry.path(), ec);
+				continue;
+			}
+			if (!IsSidecar(entry.path())) {
+				continue;
+			}
+			// unreadable files are still indexed, so they're cleaned up like any other
+			CreatedObjects::File file;
+			if (entry.path().extension() == ".bop"sv && file.Read(entry.path(), true)) {
+				AddRefs(file.chunks);
+			}
+			files.insert_or_assign(entry.path().filename().string(), std::move(file.chunks));
+		}
+
+		// chunks and temporary files left behind by an interrupted write, only exact chunk names are kept
+		for (const auto& entry : std::filesystem::directory_iterator(CreatedObjects::File::GetChunkPath(dir, 0).parent_path(), ec)) {
+			std::uint64_t chunkID = 0;
+			const auto    stem = entry.path().stem().string();
+			if (std::from_chars(stem.data(), stem.data() + stem.size(), chunkID, 16).ec != std::errc() || !HasChunk(chunkID) ||
+				entry.path().filename() != CreatedObjects::File::GetChunkPath(dir, chunkID).filename()) {
+				std::filesystem::remove(entry.path(), ec);
+			}
+		}
+
+		Log::save->info("\tIndexed {} saved files", files.size());
+
+		loaded = true;
+	}
+
+	bool SaveIndex::Save() const
+	{
+		const auto path = dir / fileName;
+		auto       tmpPath = path;
+		tmpPath += ".tmp";
+
+		{
+			std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+
+			const std::uint64_t count = files.size();
+			file.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+			file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+			file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+
+			for (const auto& [name, chunks] : files) {
+				const auto nameLength = static_cast<std::uint32_t>(name.size());
+				const auto chunkCount = static_cast<std::uint32_t>(chunks.size());
+				file.write(reinterpret_cast<const char*>(&nameLength), sizeof(nameLength));
+				file.write(name.data(), nameLength);
+				file.write(reinterpret_cast<const char*>(&chunkCount), sizeof(chunkCount));
+				file.write(reinterpret_cast<const char*>(chunks.data()), static_cast<std::streamsize>(chunks.size() * sizeof(std::uint64_t)));
+			}
+
+			if (!file) {
+				return false;
+			}
+		}
+
+		std::error_code ec;
+		std::filesystem::rename(tmpPath, path, ec);
+		return !ec;
+	}
+
+	const std::vector<std::uint64_t>* SaveIndex::GetChunks(const std::string& a_file) const
+	{
+		const auto it = files.find(a_file);
+		return it != files.end() ? std::addressof(it->second) : nullptr;
+	}
+
+	bool SaveIndex::IsSidecar(const std::filesystem::path& a_path)
+	{
+		const auto& extension = a_path.extension();
+		return extension == ".bop"sv || extension == ".json"sv;
+	}
+
+	std::vector<std::uint64_t> SaveIndex::Set(const std::string& a_file, std::vector<std::uint64_t> a_chunks)
+	{
+		// new references first, so chunks shared with the previous version of the file are never released
+		AddRefs(a_chunks);
+
+		std::vector<std::uint64_t> unused;
+		if (auto it = files.find(a_file); it != files.end()) {
+			ReleaseRefs(it->second, unused);
+			it->second = std::move(a_chunks);
+		} else {
+			files.emplace(a_file, std::move(a_chunks));
+		}
+		return unused;
+	}
+
+	std::vector<std::uint64_t> SaveIndex::Erase(const std::string& a_file)
+	{
+		std::vector<std::uint64_t> unused;
+		if (auto it = files.find(a_file); it != files.end()) {
+			ReleaseRefs(it->second, unused);
+			files.erase(it);
+		}
+		return unused;
+	}
+
+	std::vector<std::string> SaveIndex::GetFiles() const
+	{
+		std::vector<std::string> result;
+		result.reserve(files.size());
+		for (const auto& name : files | std::views::keys) {
+			result.push_back(name);
+		}
+		return result;
+	}
+
+	void SaveIndex::AddRefs(const std::vector<std::uint64_t>& a_chunks)
+	{
+		for (const auto chunkID : a_chunks) {
+			++chunkRefs[chunkID];
+		}
+	}
+
+	void SaveIndex::ReleaseRefs(const std::vector<std::uint64_t>& a_chunks, std::vector<std::uint64_t>& a_unused)
+	{
+		for (const auto chunkID : a_chunks) {
+			if (auto it = chunkRefs.find(chunkID); it != chunkRefs.end() && --it->second == 0) {
+				chunkRefs.erase(it);
+				a_unused.push_back(chunkID);
+			}
+		}
+	}
+}
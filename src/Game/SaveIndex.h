@@ -0,0 +1,41 @@
+#pragma once
+
+namespace Game
+{
+	// every sidecar in the save directory and the chunks it references, persisted next to them
+	// so cleanup never has to list the directory or open each file to find what is still in use
+	class SaveIndex
+	{
+	public:
+		bool IsLoaded() const { return loaded; }
+		bool HasChunk(std::uint64_t a_chunkID) const { return chunkRefs.contains(a_chunkID); }
+
+		bool Load(const std::filesystem::path& a_dir);
+		void Rebuild(const std::filesystem::path& a_dir);
+		bool Save() const;
+
+		const std::vector<std::uint64_t>* GetChunks(const std::string& a_file) const;
+
+		// both return chunks no sidecar references any more
+		std::vector<std::uint64_t> Set(const std::string& a_file, std::vector<std::uint64_t> a_chunks);
+		std::vector<std::uint64_t> Erase(const std::string& a_file);
+
+		std::vector<std::string> GetFiles() const;
+
+	private:
+		static constexpr std::uint32_t magic{ 'BOPI' };
+		static constexpr std::uint32_t version{ 1 };
+		static constexpr auto          fileName{ "Index.bin"sv };
+
+		static bool IsSidecar(const std::filesystem::path& a_path);
+
+		void AddRefs(const std::vector<std::uint64_t>& a_chunks);
+		void ReleaseRefs(const std::vector<std::uint64_t>& a_chunks, std::vector<std::uint64_t>& a_unused);
+
+		// members
+		std::filesystem::path                 dir;
+		StringMap<std::vector<std::uint64_t>> files;      // [sidecar file name, chunks]
+		FlatMap<std::uint64_t, std::uint32_t> chunkRefs;  // [chunk, sidecars referencing it]
+		bool                                  loaded{ false };
+	};
+}
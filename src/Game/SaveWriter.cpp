@@ -0,0 +1,259 @@
+#include "Game/SaveWriter.h"
+
+namespace Game
+{
+	void SaveWriter::Write(std::filesystem::path a_path, CreatedObjects::Snapshot a_snapshot, std::optional<std::filesystem::path> a_replaces)
+	{
+		Push({ std::move(a_path), std::move(a_snapshot), std::move(a_replaces) });
+	}
+
+	void SaveWriter::Remove(std::filesystem::path a_path)
+	{
+		Push({ std::move(a_path), std::nullopt, std::nullopt });
+	}
+
+	void SaveWriter::Post(std::move_only_function<void()> a_task)
+	{
+		Push({ .task = std::move(a_task) });
+	}
+
+	std::optional<CreatedObjects::Snapshot> SaveWriter::Load(const std::filesystem::path& a_path)
+	{
+		ResetLineage();
+		LoadIndex(a_path.parent_path());
+
+		CreatedObjects::File file;
+		if (!file.Read(a_path)) {
+			return std::nullopt;
+		}
+
+		// the index is trusted, it's only rebuilt when it disagrees with a file that is actually read
+		if (!index.GetChunks(a_path.filename().string())) {
+			Log::save->info("\t{} is not indexed", a_path.filename().string());
+			RebuildIndex(a_path.parent_path());
+		}
+
+		if (file.chunks.empty()) {
+			return file.Apply({});
+		}
+
+		CreatedObjects::Snapshot base{ .version = file.version };
+		for (const auto chunkID : file.chunks) {
+			CreatedObjects::File chunk;
+			if (!chunk.Read(CreatedObjects::File::GetChunkPath(a_path.parent_path(), chunkID)) || !chunk.chunks.empty()) {
+				// the index claimed something the directory doesn't have
+				Log::save->info("\tChunk {:016X} is missing", chunkID);
+				RebuildIndex(a_path.parent_path());
+				return std::nullopt;
+			}
+			base.entries.insert(base.entries.end(), chunk.upserts.begin(), chunk.upserts.end());
+		}
+
+		auto snapshot = file.Apply(base);
+
+		std::scoped_lock guard(lock);
+		lineage = { std::move(file.chunks), std::make_shared<const CreatedObjects::Snapshot>(std::move(base)) };
+
+		return snapshot;
+	}
+
+	void SaveWriter::ResetLineage()
+	{
+		Wait();
+
+		std::scoped_lock guard(lock);
+		lineage = {};
+	}
+
+	std::uint32_t SaveWriter::RemoveOrphans(const std::filesystem::path& a_dir, const StringSet& a_saves)
+	{
+		Wait();
+		LoadIndex(a_dir);
+
+		std::uint32_t   count = 0;
+		std::error_code ec;
+		for (const auto& file : index.GetFiles()) {
+			// a sidecar is indexed before it's written, so a write cut short leaves its temporary file under an indexed name
+			std::filesystem::remove(a_dir / (file + ".tmp"), ec);
+			if (!a_saves.contains(std::filesystem::path(file).stem().string())) {
+				std::filesystem::remove(a_dir / file, ec);
+				RemoveChunks(a_dir, index.Erase(file));
+				count++;
+			}
+		}
+
+		if (count != 0) {
+			index.Save();
+		}
+		return count;
+	}
+
+	void SaveWriter::Wait()
+	{
+		std::unique_lock guard(lock);
+		idle.wait(guard, [this] { return jobs.empty() && !busy; });
+	}
+
+	void SaveWriter::Push(Job&& a_job)
+	{
+		{
+			std::scoped_lock guard(lock);
+			jobs.push_back(std::move(a_job));
+			if (!thread.joinable()) {
+				thread = std::jthread([this](std::stop_token a_stop) { Run(a_stop); });
+			}
+		}
+		pending.notify_one();
+	}
+
+	void SaveWriter::Run(std::stop_token a_stop)
+	{
+		while (true) {
+			Job job;
+			{
+				std::unique_lock guard(lock);
+				if (!pending.wait(guard, a_stop, [this] { return !jobs.empty(); })) {
+					return;
+				}
+				job = std::move(jobs.front());
+				jobs.pop_front();
+				busy = true;
+			}
+
+			Process(job);
+
+			{
+				std::scoped_lock guard(lock);
+				busy = false;
+			}
+			idle.notify_all();
+		}
+	}
+
+	void SaveWriter::LoadIndex(const std::filesystem::path& a_dir)
+	{
+		if (!index.IsLoaded() && !index.Load(a_dir)) {
+			RebuildIndex(a_dir);
+		}
+	}
+
+	void SaveWriter::RebuildIndex(const std::filesystem::path& a_dir)
+	{
+		index.Rebuild(a_dir);
+		index.Save();
+	}
+
+	void SaveWriter::RemoveChunks(const std::filesystem::path& a_dir, const std::vector<std::uint64_t>& a_chunks)
+	{
+		std::error_code ec;
+		for (const auto chunkID : a_chunks) {
+			std::filesystem::remove(CreatedObjects::File::GetChunkPath(a_dir, chunkID), ec);
+		}
+	}
+
+	CreatedObjects::File SaveWriter::Encode(const std::filesystem::path& a_dir, CreatedObjects::Snapshot&& a_snapshot)
+	{
+		a_snapshot.sort();
+
+		if (a_snapshot.entries.size() < minBaseSize) {
+			return CreatedObjects::File::Diff({}, {}, a_snapshot);
+		}
+
+		Lineage current;
+		{
+			std::scoped_lock guard(lock);
+			current = lineage;
+		}
+
+		// the save the lineage was loaded from may have been deleted along with its chunks since
+		if (current.base && std::ranges::all_of(current.chunks, [this](const auto a_chunkID) { return index.HasChunk(a_chunkID); })) {
+			auto delta = CreatedObjects::File::Diff(*current.base, current.chunks, a_snapshot);
+			if (delta.size() * maxDeltaRatio <= current.base->entries.size()) {
+				return delta;
+			}
+		}
+
+		// compact, the current map becomes the base for this and later saves
+		std::vector<std::uint64_t> chunks;
+		std::vector<std::uint64_t> written;  // not referenced by anything yet, removed again if the base can't be finished
+
+		std::error_code ec;
+		std::filesystem::create_directories(CreatedObjects::File::GetChunkPath(a_dir, 0).parent_path(), ec);
+
+		const auto range = [](const CreatedObjects::Entry& a_entry) { return a_entry.first >> (64 - chunkBits); };
+		for (auto begin = a_snapshot.entries.begin(); begin != a_snapshot.entries.end();) {
+			const auto end = std::ranges::find_if(begin, a_snapshot.entries.end(), [&](const auto& a_entry) { return range(a_entry) != range(*begin); });
+			const auto chunkID = CreatedObjects::File::GetChunkID({ begin, end });
+			if (!index.HasChunk(chunkID) && std::ranges::find(written, chunkID) == written.end()) {
+				const CreatedObjects::File chunk{ .version = a_snapshot.version, .upserts = { begin, end } };
+				if (!chunk.Write(CreatedObjects::File::GetChunkPath(a_dir, chunkID))) {
+					Log::save->info("\tFailed to write base chunk, saving the whole map");
+					RemoveChunks(a_dir, written);
+					return CreatedObjects::File::Diff({}, {}, a_snapshot);
+				}
+				written.push_back(chunkID);
+			}
+			chunks.push_back(chunkID);
+			begin = end;
+		}
+
+		const auto version = a_snapshot.version;
+		{
+			std::scoped_lock guard(lock);
+			lineage = { chunks, std::make_shared<const CreatedObjects::Snapshot>(std::move(a_snapshot)) };
+		}
+
+		return CreatedObjects::File{ .chunks = std::move(chunks), .version = version };
+	}
+
+	void SaveWriter::Process(Job& a_job)
+	{
+		if (a_job.task) {
+			a_job.task();
+			return;
+		}
+
+		const auto dir = a_job.path.parent_path();
+		LoadIndex(dir);
+
+		if (!a_job.snapshot) {
+			std::error_code ec;
+			std::filesystem::remove(a_job.path, ec);
+			RemoveChunks(dir, index.Erase(a_job.path.filename().string()));
+			index.Save();
+			return;
+		}
+
+		auto       file = Encode(dir, std::move(*a_job.snapshot));
+		const auto name = a_job.path.filename().string();
+
+		// until the sidecar is replaced either version may be on disk, so the index holds the chunks of both
+		// and reaches disk first, it never misses a chunk a file on disk uses
+		std::optional<std::vector<std::uint64_t>> previous;
+		if (const auto chunks = index.GetChunks(name)) {
+			previous = *chunks;
+		}
+		auto both = previous.value_or(std::vector<std::uint64_t>{});
+		both.insert(both.end(), file.chunks.begin(), file.chunks.end());
+		index.Set(name, std::move(both));
+		index.Save();
+
+		if (!file.Write(a_job.path)) {
+			Log::save->info("\tFailed to save {}", name);
+			// chunks only the new version referenced were written by this job
+			RemoveChunks(dir, previous ? index.Set(name, std::move(*previous)) : index.Erase(name));
+			index.Save();
+			return;
+		}
+
+		RemoveChunks(dir, index.Set(name, std::move(file.chunks)));
+
+		if (a_job.replaces) {
+			std::error_code ec;
+			std::filesystem::remove(*a_job.replaces, ec);
+			RemoveChunks(dir, index.Erase(a_job.replaces->filename().string()));
+		}
+
+		index.Save();
+	}
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Game/CreatedObject.h"
+#include "Game/SaveIndex.h"
+
+namespace Game
+{
+	// writes saved object sidecars on a background thread so saving doesn't wait on disk I/O
+	// jobs run in the order they were queued, so a later delete of the same save can't overtake its write
+	// saves in one lineage share a base snapshot and each stores only the changes on top of it
+	// bases are split by hash range into content named chunks, so ranges identical between saves are stored once
+	class SaveWriter : public REX::Singleton<SaveWriter>
+	{
+	public:
+		void Write(std::filesystem::path a_path, CreatedObjects::Snapshot a_snapshot, std::optional<std::filesystem::path> a_replaces = std::nullopt);
+		void Remove(std::filesystem::path a_path);
+		void Post(std::move_only_function<void()> a_task);  // other files written off the save path, in order with the sidecars
+
+		// waits for pending writes, then reads a sidecar and makes its base the lineage later saves build on
+		std::optional<CreatedObjects::Snapshot> Load(const std::filesystem::path& a_path);
+		void                                    ResetLineage();
+
+		// deletes sidecars whose save is gone and the chunks only they used, returns how many
+		std::uint32_t RemoveOrphans(const std::filesystem::path& a_dir, const StringSet& a_saves);
+
+		// blocks until every queued job has finished, call before reading a sidecar back and before the process exits
+		void Wait();
+
+	private:
+		static constexpr std::size_t minBaseSize{ 1024 };  // smaller maps are cheaper to write whole
+		static constexpr std::size_t maxDeltaRatio{ 4 };   // start a new base once the changes exceed a quarter of it
+		static constexpr std::size_t chunkBits{ 6 };       // top hash bits picking a base's chunk
+
+		struct Job
+		{
+			std::filesystem::path                   path;
+			std::optional<CreatedObjects::Snapshot> snapshot;  // nullopt removes the file
+			std::optional<std::filesystem::path>    replaces;  // removed once the write succeeds
+			std::move_only_function<void()>         task;      // runs instead when set
+		};
+
+		struct Lineage
+		{
+			std::vector<std::uint64_t>                      chunks;
+			std::shared_ptr<const CreatedObjects::Snapshot> base;
+		};
+
+		void Push(Job&& a_job);
+		void Run(std::stop_token a_stop);
+		void Process(Job& a_job);
+
+		// the index is only touched by the worker, or by the main thread once the queue is drained
+		void LoadIndex(const std::filesystem::path& a_dir);
+		void RebuildIndex(const std::filesystem::path& a_dir);
+		void RemoveChunks(const std::filesystem::path& a_dir, const std::vector<std::uint64_t>& a_chunks);
+
+		CreatedObjects::File Encode(const std::filesystem::path& a_dir, CreatedObjects::Snapshot&& a_snapshot);
+
+		// members
+		mutable std::mutex          lock;
+		std::condition_variable_any pending;
+		std::condition_variable     idle;
+		std::deque<Job>             jobs;
+		bool                        busy{ false };
+		Lineage                     lineage;
+		SaveIndex                   index;
+		std::jthread                thread;
+	};
+}
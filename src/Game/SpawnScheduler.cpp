@@ -0,0 +1,156 @@
+#include "Game/SpawnScheduler.h"
+
+#include "Game/ConditionWatcher.h"
+#include "Settings.h"
+
+namespace Game
+{
+	bool SpawnScheduler::Job::IsValid() const
+	{
+		if (params.ref) {
+			if (!parentRef || parentRef->IsDeleted()) {
+				return false;
+			}
+			const auto cell = parentRef->GetParentCell();
+			return cell && cell->IsAttached();
+		}
+		return params.cell && params.cell->IsAttached();
+	}
+
+	void SpawnScheduler::Enqueue(const Object& a_object, const Object::Params& a_params)
+	{
+		const auto& filter = a_object.filter;
+		if (a_object.instances.empty() || !filter.filter.IsAllowed(a_params.ref, a_params.cell)) {
+			return;
+		}
+
+		const bool passes = filter.PassesConditions(a_params.ref);
+		if (!filter.conditionDeps.empty()) {
+			ConditionWatcher::GetSingleton()->Watch(a_object, a_params, passes);
+		}
+		if (!passes) {
+			return;
+		}
+
+		const auto origin = RE::PlayerCharacter::GetSingleton()->GetPosition();
+		const auto parentPos = a_params.ref ? a_params.refParams.bb.pos : RE::NiPoint3::Zero();
+
+		for (std::size_t idx = 0; idx < a_object.instances.size(); ++idx) {
+			const auto position = parentPos + a_object.instances[idx].transform.translate;
+			queue.push_back(Job{
+				.object = &a_object,
+				.params = a_params,
+				.parentRef = RE::TESObjectREFRPtr(a_params.ref),
+				.instanceIdx = idx,
+				.position = position,
+				.distance = origin.GetSquaredDistance(position),
+				.frame = frame });
+			std::ranges::push_heap(queue, Compare);
+		}
+	}
+
+	void SpawnScheduler::SortQueue()
+	{
+		const auto origin = RE::PlayerCharacter::GetSingleton()->GetPosition();
+		for (auto& job : queue) {
+			job.distance = origin.GetSquaredDistance(job.position);
+		}
+		std::ranges::make_heap(queue, Compare);
+	}
+
+	void SpawnScheduler::Update()
+	{
+		lastFrameSpend = frameSpend;
+		frameSpend = {};
+		frameSpawnCount = 0;
+		frame++;
+
+		LogSummary();
+
+		// after the frame advances so rechecks don't reuse last frame's cached results
+		ConditionWatcher::GetSingleton()->Update();
+
+		if (queue.empty()) {
+			return;
+		}
+
+		SortQueue();  // player may have moved since these were queued
+		Process();
+
+		if (!queue.empty()) {
+			Log::spawn->debug("Spawn queue: {} instances carried over ({}us spent last frame)", queue.size(), lastFrameSpend.count());
+		}
+	}
+
+	void SpawnScheduler::LogSummary()
+	{
+		const auto interval = Settings::GetSingleton()->GetSpawnSummaryInterval();
+		if (interval.count() == 0 || summary.empty()) {
+			return;
+		}
+
+		const auto now = clock::now();
+		if (now - summary.lastLog < interval) {
+			return;
+		}
+
+		const auto& counts = summary.counts;
+		Log::spawn->info("Spawned {} objects ({} already existed, {} over handle/formID limit, {} failed, {} queued)",
+			counts[std::to_underlying(Object::SpawnResult::kSpawned)],
+			counts[std::to_underlying(Object::SpawnResult::kExists)],
+			counts[std::to_underlying(Object::SpawnResult::kLimitReached)],
+			counts[std::to_underlying(Object::SpawnResult::kFailed)],
+			queue.size());
+
+		summary.counts.fill(0);
+		summary.lastLog = now;
+	}
+
+	void SpawnScheduler::Process()
+	{
+		if (queue.empty() || processing) {
+			return;
+		}
+
+		processing = true;
+
+		const auto budget = Settings::GetSingleton()->GetSpawnBudget();
+		const auto start = clock::now();
+
+		const SpawnContext ctx;
+
+		while (!queue.empty()) {
+			// always make some progress each frame
+			if (budget.count() > 0 && frameSpawnCount > 0 && frameSpend + std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start) >= budget) {
+				break;
+			}
+
+			std::ranges::pop_heap(queue, Compare);
+			const Job job = std::move(queue.back());
+			queue.pop_back();
+
+			// parent may have unloaded since this was queued, it'll be requeued on attach, children through their existing parent
+			if (job.frame != frame && !job.IsValid()) {
+				continue;
+			}
+
+			const auto result = job.object->SpawnInstance(ctx, job.params, job.instanceIdx);
+			summary.counts[std::to_underlying(result)]++;
+			frameSpawnCount++;
+		}
+
+		frameSpend += std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start);
+		processing = false;
+	}
+
+	void SpawnScheduler::Clear()
+	{
+		queue.clear();
+		Invalidate();
+	}
+
+	void SpawnScheduler::Invalidate()
+	{
+		frame++;
+	}
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Game/Object.h"
+
+namespace Game
+{
+	// spreads placement over several frames within a fixed time budget, nearest instances first
+	class SpawnScheduler : public REX::Singleton<SpawnScheduler>
+	{
+	public:
+		void Enqueue(const Object& a_object, const Object::Params& a_params);
+
+		void Update();
+		void Process();
+		void Clear();
+		void Invalidate();  // advances the frame so cached filter results are recomputed
+
+		std::uint64_t             GetFrame() const { return frame; }
+		std::size_t               GetQueueDepth() const { return queue.size(); }
+		std::chrono::microseconds GetLastFrameSpend() const { return lastFrameSpend; }
+
+	private:
+		using clock = std::chrono::steady_clock;
+
+		struct Job
+		{
+			bool IsValid() const;
+
+			// members
+			const Object*        object;
+			Object::Params       params;
+			RE::TESObjectREFRPtr parentRef;  // keeps the parent alive while queued
+			std::size_t          instanceIdx;
+			RE::NiPoint3         position;
+			float                distance;
+			std::uint64_t        frame;
+		};
+
+		// aggregated into one periodic log line instead of one line per spawn
+		struct Summary
+		{
+			bool empty() const { return std::ranges::all_of(counts, [](auto a_count) { return a_count == 0; }); }
+
+			// members
+			std::array<std::uint32_t, 4> counts{};  // indexed by Object::SpawnResult
+			clock::time_point            lastLog{};
+		};
+
+		static bool Compare(const Job& a_lhs, const Job& a_rhs) { return a_lhs.distance > a_rhs.distance; }  // min heap
+
+		void SortQueue();
+		void LogSummary();
+
+		// members
+		std::vector<Job>          queue;
+		std::chrono::microseconds frameSpend{};
+		std::chrono::microseconds lastFrameSpend{};
+		std::uint64_t             frame{ 0 };
+		std::uint32_t             frameSpawnCount{ 0 };
+		Summary                   summary;
+		bool                      processing{ false };
+	};
+}
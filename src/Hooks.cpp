@@ -51,6 +51,10 @@ namespace Hooks
 		InitHavok<RE::Hazard>::Install();
 		InitHavok<RE::ArrowProjectile>::Install();
 
+		PlayerUpdate::Install();
+
+		ExitProcess::Install();
+
 		//TESObjectREFR__Set3DSimple::Install();
 		//TESObjectREFR__MarkedAsPickedUp::Install();
 	}
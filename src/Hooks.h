@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Game/SaveWriter.h"
+#include "Game/SpawnScheduler.h"
 #include "Manager.h"
 
 namespace Hooks
@@ -67,5 +69,48 @@ namespace Hooks
 		}
 	};
 
+	// drains the spawn queue once per frame
+	struct PlayerUpdate
+	{
+		static void thunk(RE::PlayerCharacter* a_this, float a_delta)
+		{
+			func(a_this, a_delta);
+
+			Game::SpawnScheduler::GetSingleton()->Update();
+		}
+		static inline REL::Relocation<decltype(thunk)> func;
+		static constexpr std::size_t                   idx{ 0xAD };
+
+		static void Install()
+		{
+			logger::info("Installing PlayerCharacter::Update hook");
+			stl::write_vfunc<RE::PlayerCharacter, PlayerUpdate>();
+		}
+	};
+
+	// saving right before quitting only queues the sidecar write, so finish it before the process goes away
+	struct ExitProcess
+	{
+		static void thunk(std::uint32_t a_exitCode)
+		{
+			logger::info("Flushing saved files before exit");
+			Game::SaveWriter::GetSingleton()->Wait();
+
+			func(a_exitCode);
+		}
+		static inline REL::Relocation<decltype(thunk)> func;
+
+		static void Install()
+		{
+			logger::info("Installing ExitProcess hook");
+			const auto original = SKSE::PatchIAT(reinterpret_cast<std::uintptr_t>(thunk), "kernel32.dll"sv, "ExitProcess"sv);
+			if (original == 0) {
+				logger::error("\tFailed to patch ExitProcess import, saves still being written may be lost on quit");
+				return;
+			}
+			func = original;
+		}
+	};
+
 	void Install();
 }
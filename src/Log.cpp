@@ -0,0 +1,51 @@
+#include "Log.h"
+
+namespace Log
+{
+	namespace detail
+	{
+		constexpr std::size_t queueSize{ 8192 };
+
+		std::shared_ptr<spdlog::logger> make_logger(std::string a_name, spdlog::sink_ptr a_sink)
+		{
+			// drop the oldest lines rather than stall the game thread when the writer falls behind
+			auto log = std::make_shared<spdlog::async_logger>(std::move(a_name), std::move(a_sink), spdlog::thread_pool(), spdlog::async_overflow_policy::overrun_oldest);
+
+			log->set_level(spdlog::level::info);
+			log->flush_on(spdlog::level::warn);
+
+			return log;
+		}
+	}
+
+	void Init()
+	{
+		auto path = logger::log_directory();
+		if (!path) {
+			stl::report_and_fail("Failed to find standard logging directory"sv);
+		}
+
+		*path /= fmt::format(FMT_STRING("{}.log"), Version::PROJECT);
+		auto sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>(path->string(), true);
+		sink->set_pattern("%v"s);
+
+		spdlog::init_thread_pool(detail::queueSize, 1);
+
+		config = detail::make_logger("config"s, sink);
+		spawn = detail::make_logger("spawn"s, sink);
+		save = detail::make_logger("save"s, sink);
+
+		spdlog::set_default_logger(detail::make_logger("global log"s, std::move(sink)));
+		spdlog::flush_every(3s);
+
+		logger::info(FMT_STRING("{} v{}"), Version::PROJECT, Version::NAME);
+	}
+
+	void SetLevels(spdlog::level::level_enum a_level, spdlog::level::level_enum a_config, spdlog::level::level_enum a_spawn, spdlog::level::level_enum a_save)
+	{
+		spdlog::default_logger()->set_level(a_level);
+		config->set_level(a_config);
+		spawn->set_level(a_spawn);
+		save->set_level(a_save);
+	}
+}
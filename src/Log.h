@@ -0,0 +1,14 @@
+#pragma once
+
+// async file logging, split into per-subsystem categories that can be tuned independently
+// everything shares one sink and one background thread, so hot paths only push to a queue
+namespace Log
+{
+	void Init();
+	void SetLevels(spdlog::level::level_enum a_level, spdlog::level::level_enum a_config, spdlog::level::level_enum a_spawn, spdlog::level::level_enum a_save);
+
+	// members
+	inline std::shared_ptr<spdlog::logger> config;  // config parsing and resolving
+	inline std::shared_ptr<spdlog::logger> spawn;   // placement, per object lines are debug only
+	inline std::shared_ptr<spdlog::logger> save;    // sidecar files and caches
+}
@@ -1,5 +1,11 @@
 #include "Manager.h"
 
+#include "Game/ClipCache.h"
+#include "Game/ConditionWatcher.h"
+#include "Game/HandleBudget.h"
+#include "Game/SaveWriter.h"
+#include "Game/SpawnScheduler.h"
+
 void Manager::LoadPrefabs()
 {
 	std::filesystem::path dir{ R"(Data\BaseObjectPlacer\Prefabs)" };
@@ -9,7 +15,7 @@ void Manager::LoadPrefabs()
 		return;
 	}
 
-	logger::info("{:*^50}", "PREFABS");
+	Log::config->info("{:*^50}", "PREFABS");
 
 	std::string buffer;
 
@@ -25,10 +31,10 @@ void Manager::LoadPrefabs()
 	std::ranges::sort(paths);
 
 	for (auto& path : paths) {
-		logger::info("Reading {}...", path.string());
+		Log::config->info("Reading {}...", path.string());
 		Config::PrefabList prefabList;
 		if (auto err = glz::read_file_json<glz::opts{ .error_on_missing_keys = true }>(prefabList, path.string(), buffer)) {
-			logger::error("\terror:{}", glz::format_error(err, buffer));
+			Log::config->error("\terror:{}", glz::format_error(err, buffer));
 		} else {
 			for (auto& prefab : prefabList.prefabs) {
 				StorePrefab(prefab);
@@ -36,18 +42,18 @@ void Manager::LoadPrefabs()
 		}
 	}
 
-	logger::info("Loaded {} prefabs", cachedPrefabs.size());
+	Log::config->info("Loaded {} prefabs", cachedPrefabs.size());
 }
 
 std::pair<bool, bool> Manager::ReadConfigs(bool a_reload)
 {
-	logger::info("{:*^50}", a_reload ? "RELOAD" : "CONFIG FILES");
+	Log::config->info("{:*^50}", a_reload ? "RELOAD" : "CONFIG FILES");
 
 	static std::filesystem::path dir{ R"(Data\BaseObjectPlacer)" };
 
 	std::error_code ec;
 	if (!std::filesystem::exists(dir, ec)) {
-		logger::info("Data\\BaseObjectPlacer folder not found ({})", ec.message());
+		Log::config->info("Data\\BaseObjectPlacer folder not found ({})", ec.message());
 		return { false, true };
 	}
 
@@ -55,6 +61,7 @@ std::pair<bool, bool> Manager::ReadConfigs(bool a_reload)
 		configs.clear();
 		cachedPrefabs.clear();
 		ConfigObjectArray::Word::ClearCharMap();
+		ConditionParser::ClearCompiled();
 	}
 	ConfigObjectArray::Word::InitCharMap();
 
@@ -76,6 +83,8 @@ std::pair<bool, bool> Manager::ReadConfigs(bool a_reload)
 
 	std::ranges::sort(paths);
 
+	configSignature = 0;
+
 	bool                has_error = false;
 	std::string         buffer;
 	constexpr glz::opts opts{
@@ -84,7 +93,8 @@ std::pair<bool, bool> Manager::ReadConfigs(bool a_reload)
 
 	for (auto& path : paths) {
 		currentConfigHash = hash::combine(path.string());
-		logger::info("{} {}...", a_reload ? "Reloading" : "Reading", path.string());
+		configSignature = hash::combine(configSignature, currentConfigHash, std::filesystem::last_write_time(path, ec).time_since_epoch().count());
+		Log::config->info("{} {}...", a_reload ? "Reloading" : "Reading", path.string());
 		Config::Format tmpConfig;
 		glz::error_ctx err{};
 		const auto&    extension = path.extension();
@@ -97,17 +107,54 @@ std::pair<bool, bool> Manager::ReadConfigs(bool a_reload)
 		}
 		if (err) {
 			has_error = true;
-			logger::error("\terror:{}", glz::format_error(err, buffer));
+			Log::config->error("\terror:{}", glz::format_error(err, buffer));
 		} else {
+			tmpConfig.SetSamplingMode();
 			configs.merge(tmpConfig);
 		}
 	}
 
 	LoadPrefabs();
+	CompileConditions();
 
 	return { !configs.empty(), has_error };
 }
 
+void Manager::CompileConditions()
+{
+	std::vector<Config::FilterData*> filters;
+
+	const auto collect = [&](this auto&& self, Config::Prefab& a_prefab) -> void {
+		filters.push_back(&a_prefab.filter);
+		for (auto& child : a_prefab.children) {
+			if (auto* prefab = std::get_if<Config::Prefab>(&child)) {
+				self(*prefab);
+			}
+		}
+	};
+
+	for (auto& prefab : cachedPrefabs | std::views::values) {
+		collect(prefab);
+	}
+	for (auto* map : { &configs.cells, &configs.objects, &configs.objectTypes }) {
+		for (auto& object : *map | std::views::values | std::views::join) {
+			filters.push_back(&object.filter);
+			if (auto* prefab = std::get_if<Config::Prefab>(&object.prefab)) {
+				collect(*prefab);
+			}
+		}
+	}
+
+	std::erase_if(filters, [](const auto* a_filter) { return a_filter->conditions.empty(); });
+
+	// grammar and literals don't need the game data, forms are resolved once per unique list at data load
+	std::for_each(std::execution::par, filters.begin(), filters.end(), [](auto* a_filter) {
+		a_filter->CompileConditions();
+	});
+
+	Log::config->info("Compiled {} condition lists", filters.size());
+}
+
 void Manager::ReloadConfigs()
 {
 	currentConfigHash = 0;
@@ -117,12 +164,17 @@ void Manager::ReloadConfigs()
 		return;
 	}
 
+	Game::SpawnScheduler::GetSingleton()->Clear();
+	Game::ConditionWatcher::GetSingleton()->Clear();
 	game.clear();
 	configObjects.clear();
 
 	ResolvePrefabs();
 	ProcessConfigs();
 
+	SaveClipCache();
+	LoadClipCache();
+
 	SKSE::GetTaskInterface()->AddTask([this]() {
 		ClearSavedObjects(true);
 		PlaceInLoadedArea();
@@ -135,23 +187,27 @@ void Manager::OnDataLoad()
 		return;
 	}
 
-	logger::info("{:*^50}", "RESULTS");
+	Log::config->info("{:*^50}", "RESULTS");
 
 	ResolvePrefabs();
 	ProcessConfigs();
 
+	LoadClipCache();
+
 	if (!game.cells.empty()) {
 		detail::add_event_sink<RE::TESCellFullyLoadedEvent>();
-		logger::info("Registered for cell load event");
+		Log::config->info("Registered for cell load event");
 	}
 
 	detail::add_event_sink<RE::TESCellAttachDetachEvent>();
-	logger::info("Registered for cell attach event");
+	Log::config->info("Registered for cell attach event");
 
 	detail::add_event_sink<RE::TESLoadGameEvent>();
 	detail::add_event_sink<RE::TESFormDeleteEvent>();
 
-	logger::info("{:*^50}", "FILE CLEANUP");
+	Game::ConditionWatcher::GetSingleton()->Register();
+
+	Log::config->info("{:*^50}", "FILE CLEANUP");
 	CleanupSavedFiles();
 }
 
@@ -165,12 +221,12 @@ void Manager::ResolvePrefabs()
 void Manager::StorePrefab(const Config::Prefab& a_prefab)
 {
 	if (a_prefab.uuid.empty()) {
-		logger::error("\tPrefab with empty uuid found, skipping...");
+		Log::config->error("\tPrefab with empty uuid found, skipping...");
 		return;
 	}
-	logger::info("\tLoading prefab with UUID '{}'", a_prefab.uuid);
+	Log::config->info("\tLoading prefab with UUID '{}'", a_prefab.uuid);
 	if (!cachedPrefabs.try_emplace(a_prefab.uuid, a_prefab).second) {
-		logger::error("\t\tDuplicate '{}' UUID found. Discarding.", a_prefab.uuid);
+		Log::config->error("\t\tDuplicate '{}' UUID found. Discarding.", a_prefab.uuid);
 	}
 	for (auto& childPrefab : a_prefab.children) {
 		if (auto prefabPtr = std::get_if<Config::Prefab>(&childPrefab)) {
@@ -232,28 +288,86 @@ void Manager::ProcessConfigs()
 		process_and_merge(objects, typeStr, game.objectTypes[formType]);
 	}
 
+	game.BuildIndex();
+
 	configs.clear();
 	cachedPrefabs.clear();
 }
 
 void Manager::PlaceInLoadedArea()
 {
-	bool placeAtReferences = !game.objects.empty() || !game.objectTypes.empty();
-	bool placeInCells = !game.cells.empty();
-
-	RE::TES::GetSingleton()->ForEachCell([&](auto* cell) {
-		if (placeAtReferences) {
-			cell->ForEachReference([this](auto* ref) {
-				if (!ref->IsDynamicForm()) {
-					game.SpawnAtReference(ref);
-				}
-				return RE::BSContainer::ForEachResult::kContinue;
-			});
-		}
-		if (placeInCells) {
-			game.SpawnInCell(cell);
+	game.SpawnInLoadedArea();
+	Game::SpawnScheduler::GetSingleton()->Process();
+}
+
+void Manager::QueueReference(const RE::TESObjectREFRPtr& a_ref, bool a_attached)
+{
+	std::scoped_lock lock(batchLock);
+
+	pendingBatch.references.insert_or_assign(a_ref->GetFormID(), std::make_pair(a_ref, a_attached));  // latest state wins
+	if (!std::exchange(batchQueued, true)) {
+		SKSE::GetTaskInterface()->AddTask([this]() {
+			ProcessSpawnBatch();
+		});
+	}
+}
+
+void Manager::QueueCell(RE::TESObjectCELL* a_cell)
+{
+	std::scoped_lock lock(batchLock);
+
+	pendingBatch.cells.emplace(a_cell);
+	if (!std::exchange(batchQueued, true)) {
+		SKSE::GetTaskInterface()->AddTask([this]() {
+			ProcessSpawnBatch();
+		});
+	}
+}
+
+void Manager::ProcessSpawnBatch()
+{
+	SpawnBatch batch;
+	{
+		std::scoped_lock lock(batchLock);
+		std::swap(batch, pendingBatch);
+		batchQueued = false;
+	}
+
+	if (batch.empty()) {
+		return;
+	}
+
+	std::vector<std::pair<RE::TESObjectREFR*, RE::FormID>> attachedRefs;  // [ref, base]
+	attachedRefs.reserve(batch.references.size());
+
+	for (auto& [formID, entry] : batch.references) {
+		auto& [ref, attached] = entry;
+		if (attached) {
+			if (!ref->IsDynamicForm()) {
+				const auto base = ref->GetBaseObject();
+				attachedRefs.emplace_back(ref.get(), base ? base->GetFormID() : 0);
+			}
+		} else if (ref->IsDynamicForm()) {
+			ClearTempObject(ref.get());
 		}
-	});
+	}
+
+	if (attachedRefs.empty() && batch.cells.empty()) {
+		return;
+	}
+
+	// group references sharing a base object
+	std::ranges::sort(attachedRefs, {}, [](const auto& a_entry) { return a_entry.second; });
+
+	const Game::SpawnContext ctx;
+	for (const auto& ref : attachedRefs | std::views::keys) {
+		game.SpawnAtReference(ref, ctx);
+	}
+	for (const auto& cell : batch.cells) {
+		game.SpawnInCell(cell, ctx);
+	}
+
+	ctx.scheduler->Process();
 }
 
 std::optional<std::filesystem::path> Manager::GetSaveDirectory()
@@ -274,88 +388,120 @@ std::optional<std::filesystem::path> Manager::GetSaveDirectory()
 	return saveDirectory;
 }
 
-std::optional<std::filesystem::path> Manager::GetFile(std::string_view a_save)
+void Manager::LoadClipCache()
+{
+	const auto saveDir = GetSaveDirectory();
+	if (!saveDir) {
+		return;
+	}
+
+	// corrected positions depend on config contents and on the bounds of whatever the load order resolves bases to
+	auto signature = configSignature;
+	for (const auto& file : RE::TESDataHandler::GetSingleton()->files) {
+		if (file) {
+			signature = hash::combine(signature, std::string_view(file->fileName));
+		}
+	}
+
+	Game::ClipCache::GetSingleton()->Load(*saveDir / clipCacheFile, signature);
+}
+
+void Manager::SaveClipCache()
+{
+	if (const auto saveDir = GetSaveDirectory()) {
+		Game::ClipCache::GetSingleton()->Save(*saveDir / clipCacheFile);
+	}
+}
+
+std::optional<std::filesystem::path> Manager::GetFile(std::string_view a_save, std::string_view a_extension)
 {
 	const auto saveDir = GetSaveDirectory();
 	if (!saveDir) {
 		return std::nullopt;
 	}
 
-	auto jsonPath = saveDir;
-	*jsonPath /= a_save;
-	jsonPath->replace_extension(".json");
+	auto path = saveDir;
+	*path /= a_save;
+	path->replace_extension(a_extension);
 
-	return jsonPath;
+	return path;
 }
 
 void Manager::SaveFiles(std::string_view a_save)
 {
+	SaveClipCache();
+
 	if (savedObjects.empty()) {
 		return;
 	}
 
-	auto jsonPath = GetFile(a_save);
-	if (!jsonPath) {
+	auto path = GetFile(a_save);
+	if (!path) {
 		return;
 	}
 
-	logger::info("Saving {}", jsonPath->filename().string());
-	logger::info("\t{} saved objects", savedObjects.size());
-
-	std::string buffer;
-	auto        ec = glz::write_file_json<glz::opts{ .minified = true }>(savedObjects, jsonPath->string(), buffer);
+	Log::save->info("Saving {}", path->filename().string());
+	Log::save->info("\t{} saved objects", savedObjects.size());
 
-	if (ec) {
-		logger::info("\tFailed to save file: (error: {})", glz::format_error(ec, buffer));
-	}
+	Game::SaveWriter::GetSingleton()->Write(*path, savedObjects.snapshot(), GetFile(a_save, legacyFileExtension));
 }
 
 void Manager::LoadFiles(std::string_view a_save)
 {
 	loadingSave = true;
 
-	logger::info("Loading save {}", a_save);
+	Log::save->info("Loading save {}", a_save);
+
+	Game::SpawnScheduler::GetSingleton()->Clear();
+	Game::ConditionWatcher::GetSingleton()->Clear();
 
-	logger::info("\tDeleting {} temp objects", tempObjects.size());
+	Log::save->info("\tDeleting {} temp objects", tempObjects.size());
 	tempObjects.clear(true);
 
-	const auto& jsonPath = GetFile(a_save);
-	if (!jsonPath) {
+	const auto& path = GetFile(a_save);
+	if (!path) {
 		return;
 	}
 
 	savedObjects.clear();
 
+	// a save made moments ago may still be writing, both wait for it
+	const auto writer = Game::SaveWriter::GetSingleton();
+
 	std::error_code err;
-	if (std::filesystem::exists(*jsonPath, err)) {
-		std::string buffer;
-		auto        ec = glz::read_file_json<glz::opts{ .minified = true }>(savedObjects, jsonPath->string(), buffer);
-		if (ec) {
-			logger::info("\tFailed to read json (error: {})", glz::format_error(ec, buffer));
+	if (std::filesystem::exists(*path, err)) {
+		if (auto snapshot = writer->Load(*path)) {
+			savedObjects.assign(*snapshot);
+		} else {
+			Log::save->info("\tFailed to read {}", path->filename().string());
+		}
+	} else {
+		writer->ResetLineage();
+		if (const auto legacyPath = GetFile(a_save, legacyFileExtension); std::filesystem::exists(*legacyPath, err)) {
+			Log::save->info("\tMigrating {}", legacyPath->filename().string());
+			std::string buffer;
+			auto        ec = glz::read_file_json<glz::opts{ .minified = true }>(savedObjects, legacyPath->string(), buffer);
+			if (ec) {
+				Log::save->info("\tFailed to read json (error: {})", glz::format_error(ec, buffer));
+			}
 		}
 	}
 
-	logger::info("\t{} saved objects", savedObjects.size());
+	Log::save->info("\t{} saved objects", savedObjects.size());
 
 	// delete hashes not present
-	if (!savedObjects.empty()) {
-		erase_if(savedObjects.map,
-			[this](const auto& entry) {
-				return !configObjects.contains(entry.first);
-			});
-		savedObjects.rebuild_inverse_map();
-	}
+	savedObjects.erase_if([this](std::size_t a_hash, RE::FormID) {
+		return !configObjects.contains(a_hash);
+	});
 }
 
 void Manager::DeleteSavedFiles(std::string_view a_save)
 {
-	auto jsonPath = GetFile(a_save);
-	if (!jsonPath) {
-		return;
+	for (const auto extension : { savedFileExtension, legacyFileExtension }) {
+		if (auto path = GetFile(a_save, extension)) {
+			Game::SaveWriter::GetSingleton()->Remove(std::move(*path));
+		}
 	}
-
-	std::error_code ec;
-	std::filesystem::remove(*jsonPath, ec);
 }
 
 void Manager::CleanupSavedFiles()
@@ -377,21 +523,23 @@ void Manager::CleanupSavedFiles()
 	std::uint32_t count = 0;
 
 	if (auto bopSaveDir = GetSaveDirectory()) {
+		// one listing of the game's saves, the sidecars themselves come from the index
+		StringSet       saves;
 		std::error_code ec;
-
-		for (const auto& entry : std::filesystem::directory_iterator(*bopSaveDir)) {
-			if (entry.exists() && entry.path().extension() == ".json"sv) {
-				auto saveFileName = entry.path().stem().string();
-				auto savePath = std::format("{}{}.ess", gameSaveDir->string(), saveFileName);
-				if (!std::filesystem::exists(savePath, ec)) {
-					std::filesystem::remove(entry.path(), ec);
-					count++;
-				}
+		for (const auto& entry : std::filesystem::directory_iterator(*gameSaveDir, ec)) {
+			if (entry.path().extension() == ".ess"sv) {
+				saves.insert(entry.path().stem().string());
 			}
 		}
+		if (ec) {
+			Log::save->info("Couldn't list saves ({}), skipping cleanup.", ec.message());
+			return;
+		}
+
+		count = Game::SaveWriter::GetSingleton()->RemoveOrphans(*bopSaveDir, saves);
 	}
 
-	logger::info("Cleaned up {} orphaned saved files.", count);
+	Log::save->info("Cleaned up {} orphaned saved files.", count);
 }
 
 bool Manager::IsTempObject(RE::TESObjectREFR* a_ref) const
@@ -422,6 +570,7 @@ void Manager::ClearTempObject(RE::TESObjectREFR* a_ref)
 {
 	if (tempObjects.erase(a_ref->GetFormID())) {
 		RE::GarbageCollector::GetSingleton()->Add(a_ref, true);
+		Game::HandleBudget::GetSingleton()->Release();
 	}
 }
 
@@ -464,10 +613,10 @@ void Manager::FinishLoadSerializedObject(RE::TESObjectREFR* a_ref) const
 
 		bool shouldDeleteRef = false;
 		if (!savedID) {
-			logger::error("\t\tObject with hash {} did not have a corresponding config entry. Deleting saved object. [FormID: {:X}]", hash, a_ref->GetFormID());
+			Log::save->error("\t\tObject with hash {} did not have a corresponding config entry. Deleting saved object. [FormID: {:X}]", hash, a_ref->GetFormID());
 			shouldDeleteRef = true;
 		} else if (savedID != curID) {
-			logger::error("\t\tObject {:X} - saved ID and current ID mismatch. Deleting saved object. [Expected: ({:X}), Found: ({:X})]",
+			Log::save->error("\t\tObject {:X} - saved ID and current ID mismatch. Deleting saved object. [Expected: ({:X}), Found: ({:X})]",
 				a_ref->GetFormID(), savedID, curID);
 			shouldDeleteRef = true;
 		}
@@ -514,9 +663,7 @@ RE::BSEventNotifyControl Manager::ProcessEvent(const RE::TESCellFullyLoadedEvent
 		return RE::BSEventNotifyControl::kContinue;
 	}
 
-	SKSE::GetTaskInterface()->AddTask([this, cell = a_event->cell]() {
-		game.SpawnInCell(cell);
-	});
+	QueueCell(a_event->cell);
 
 	return RE::BSEventNotifyControl::kContinue;
 }
@@ -532,17 +679,7 @@ RE::BSEventNotifyControl Manager::ProcessEvent(const RE::TESCellAttachDetachEven
 		return RE::BSEventNotifyControl::kContinue;
 	}
 
-	SKSE::GetTaskInterface()->AddTask([this, ref = refr, attached = a_event->attached]() {
-		if (attached) {
-			if (!ref->IsDynamicForm()) {
-				game.SpawnAtReference(ref.get());
-			}
-		} else {
-			if (ref->IsDynamicForm()) {
-				ClearTempObject(ref.get());
-			}
-		}
-	});
+	QueueReference(refr, a_event->attached);
 
 	return RE::BSEventNotifyControl::kContinue;
 }
@@ -556,6 +693,7 @@ RE::BSEventNotifyControl Manager::ProcessEvent(const RE::TESLoadGameEvent* a_eve
 	logger::info("Finished loading save game");
 
 	SKSE::GetTaskInterface()->AddTask([this]() {
+		Game::SpawnScheduler::GetSingleton()->Invalidate();  // world state changed since the last cached results
 		PlaceInLoadedArea();
 		loadingSave = false;
 	});
@@ -566,8 +704,11 @@ RE::BSEventNotifyControl Manager::ProcessEvent(const RE::TESLoadGameEvent* a_eve
 RE::BSEventNotifyControl Manager::ProcessEvent(const RE::TESFormDeleteEvent* a_event, RE::BSTEventSource<RE::TESFormDeleteEvent>*)
 {
 	if (a_event && a_event->formID != 0) {
-		savedObjects.erase(a_event->formID);
-		tempObjects.erase(a_event->formID);
+		const bool savedObject = savedObjects.erase(a_event->formID);
+		const bool tempObject = tempObjects.erase(a_event->formID);
+		if (savedObject || tempObject) {
+			Game::HandleBudget::GetSingleton()->Release();
+		}
 	}
 
 	return RE::BSEventNotifyControl::kContinue;
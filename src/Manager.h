@@ -13,6 +13,7 @@ class Manager :
 {
 public:
 	void                  LoadPrefabs();
+	void                  CompileConditions();
 	std::pair<bool, bool> ReadConfigs(bool a_reload = false);
 	void                  ReloadConfigs();
 	std::size_t           GetCurrentConfigHash() const { return currentConfigHash; }
@@ -57,11 +58,31 @@ private:
 		}
 	};
 
+	static constexpr auto clipCacheFile{ "ClipCache.bin"sv };
+	static constexpr auto savedFileExtension{ ".bop"sv };
+	static constexpr auto legacyFileExtension{ ".json"sv };  // read once and replaced on the next save
+
+	struct SpawnBatch
+	{
+		bool empty() const { return references.empty() && cells.empty(); }
+
+		// members
+		FlatMap<RE::FormID, std::pair<RE::TESObjectREFRPtr, bool>> references;  // [ref, (ref, attached)]
+		FlatSet<RE::TESObjectCELL*>                                cells;
+	};
+
 	void ProcessConfigs();
 	void PlaceInLoadedArea();
 
+	void QueueReference(const RE::TESObjectREFRPtr& a_ref, bool a_attached);
+	void QueueCell(RE::TESObjectCELL* a_cell);
+	void ProcessSpawnBatch();
+
 	std::optional<std::filesystem::path> GetSaveDirectory();
-	std::optional<std::filesystem::path> GetFile(std::string_view a_save);
+	std::optional<std::filesystem::path> GetFile(std::string_view a_save, std::string_view a_extension = savedFileExtension);
+
+	void LoadClipCache();
+	void SaveClipCache();
 
 	template <class F>
 	bool VisitSerializedObject(RE::TESObjectREFR* a_ref, F&& func)
@@ -90,5 +111,9 @@ private:
 	CreatedObjects                            tempObjects;
 	std::optional<std::filesystem::path>      saveDirectory;
 	std::size_t                               currentConfigHash{ 0 };
+	std::size_t                               configSignature{ 0 };  // config paths + write times
 	bool                                      loadingSave{ false };
+	std::mutex                                batchLock;
+	SpawnBatch                                pendingBatch;
+	bool                                      batchQueued{ false };
 };
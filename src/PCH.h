@@ -3,7 +3,13 @@
 #define WIN32_LEAN_AND_MEAN
 #define NOMINMAX
 
+#include <charconv>
+#include <condition_variable>
+#include <deque>
+#include <execution>
+#include <functional>
 #include <shared_mutex>
+#include <thread>
 
 #include "RE/Skyrim.h"
 #include "SKSE/SKSE.h"
@@ -23,8 +29,8 @@
 #include <glaze/glaze.hpp>
 #include <glaze/toml.hpp>
 #include <glaze/yaml.hpp>
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
-#include <srell.hpp>
 #include <xbyak/xbyak.h>
 
 #include "ClibUtil/editorID.hpp"
@@ -159,6 +165,7 @@ namespace stl
 	}
 }
 
+#include "Log.h"
 #include "RE.h"
 #include "Version.h"
 
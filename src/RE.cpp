@@ -85,6 +85,41 @@ namespace RE
 		return form ? clib_util::editorID::get_editorID(form) : "";
 	}
 
+	namespace detail
+	{
+		const StringMap<BGSKeyword*>& GetKeywordIndex()
+		{
+			static const auto index = [] {
+				StringMap<BGSKeyword*> map;
+				const auto&            keywords = TESDataHandler::GetSingleton()->GetFormArray<BGSKeyword>();
+				map.reserve(keywords.size());
+				for (const auto& keyword : keywords) {
+					if (keyword && !keyword->formEditorID.empty()) {
+						map.emplace(keyword->formEditorID.c_str(), keyword);
+					}
+				}
+				return map;
+			}();
+			return index;
+		}
+	}
+
+	BGSKeyword* GetKeyword(std::string_view a_str)
+	{
+		const auto& index = detail::GetKeywordIndex();
+		if (const auto it = index.find(a_str); it != index.end()) {
+			return it->second;
+		}
+		const auto form = GetForm(std::string(a_str));
+		return form ? form->As<BGSKeyword>() : nullptr;
+	}
+
+	FormID GetKeywordFormID(std::string_view a_str)
+	{
+		const auto keyword = GetKeyword(a_str);
+		return keyword ? keyword->GetFormID() : 0;
+	}
+
 	bool CanBeMoved(const TESObjectREFRPtr& a_refr)
 	{
 		auto base = a_refr->GetBaseObject();
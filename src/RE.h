@@ -103,6 +103,10 @@ namespace RE
 	FormID      GetFormID(const std::string& a_str);
 	std::string GetEditorID(const std::string& a_str);
 
+	// keyword editorIDs are resolved through an index built on first use
+	BGSKeyword* GetKeyword(std::string_view a_str);
+	FormID      GetKeywordFormID(std::string_view a_str);
+
 	// game function returns true for dynamic refs
 	bool CanBeMoved(const TESObjectREFRPtr& a_refr);
 	bool CanBeMoved(const TESForm* a_base);
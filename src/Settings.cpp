@@ -0,0 +1,44 @@
+#include "Settings.h"
+
+spdlog::level::level_enum Settings::GetLevel(const CSimpleIniA& a_ini, const char* a_key, spdlog::level::level_enum a_default)
+{
+	if (const auto value = a_ini.GetValue("Logging", a_key)) {
+		if (const auto level = spdlog::level::from_str(value); level != spdlog::level::off || string::iequals(value, "off")) {
+			return level;
+		}
+	}
+	return a_default;
+}
+
+void Settings::Load()
+{
+	constexpr auto path = LR"(Data\SKSE\Plugins\po3_BaseObjectPlacer.ini)";
+
+	CSimpleIniA ini;
+	ini.SetUnicode();
+
+	const bool found = ini.LoadFile(path) >= 0;
+
+	spawnBudget = static_cast<std::uint32_t>(ini.GetLongValue("Spawning", "iFrameBudgetMicroseconds", static_cast<long>(spawnBudget)));
+	spawnSummaryInterval = static_cast<std::uint32_t>(ini.GetLongValue("Logging", "iSpawnSummaryInterval", static_cast<long>(spawnSummaryInterval)));
+	conditionPollInterval = static_cast<std::uint32_t>(ini.GetLongValue("Spawning", "iConditionPollMilliseconds", static_cast<long>(conditionPollInterval)));
+
+	// category levels fall back to the global one
+	const auto level = GetLevel(ini, "sLevel", spdlog::level::info);
+	Log::SetLevels(level,
+		GetLevel(ini, "sConfigLevel", level),
+		GetLevel(ini, "sSpawnLevel", level),
+		GetLevel(ini, "sSaveLevel", level));
+
+	logger::info("{:*^50}", "SETTINGS");
+	if (!found) {
+		logger::info("po3_BaseObjectPlacer.ini not found, using default settings");
+	}
+	logger::info("Spawn budget : {}us per frame", spawnBudget);
+	logger::info("Condition poll interval : {}ms", conditionPollInterval);
+	logger::info("Log levels : {} (config: {}, spawn: {}, save: {})",
+		spdlog::level::to_string_view(level),
+		spdlog::level::to_string_view(Log::config->level()),
+		spdlog::level::to_string_view(Log::spawn->level()),
+		spdlog::level::to_string_view(Log::save->level()));
+}
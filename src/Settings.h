@@ -0,0 +1,19 @@
+#pragma once
+
+class Settings : public REX::Singleton<Settings>
+{
+public:
+	void Load();
+
+	std::chrono::microseconds GetSpawnBudget() const { return std::chrono::microseconds(spawnBudget); }
+	std::chrono::seconds      GetSpawnSummaryInterval() const { return std::chrono::seconds(spawnSummaryInterval); }
+	std::chrono::milliseconds GetConditionPollInterval() const { return std::chrono::milliseconds(conditionPollInterval); }
+
+private:
+	static spdlog::level::level_enum GetLevel(const CSimpleIniA& a_ini, const char* a_key, spdlog::level::level_enum a_default);
+
+	// members
+	std::uint32_t spawnBudget{ 2000 };            // microseconds per frame, 0 = spawn everything immediately
+	std::uint32_t spawnSummaryInterval{ 5 };      // seconds between aggregated spawn log lines, 0 = disabled
+	std::uint32_t conditionPollInterval{ 1000 };  // milliseconds between condition rechecks of loaded placements, 0 = disabled
+};
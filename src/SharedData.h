@@ -1,6 +1,7 @@
 #pragma once
 
 #include "SharedData/ConditionParser.h"
+#include "SharedData/ConditionProgram.h"
 #include "SharedData/ExtraData.h"
 #include "SharedData/Object.h"
 #include "SharedData/Script.h"
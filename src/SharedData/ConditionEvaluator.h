@@ -0,0 +1,113 @@
+#pragma once
+
+// the instruction list ConditionProgram lowers a TESCondition to and the evaluator that runs it, kept free of game types
+// so it can be run against a mock state. Forms, condition items and refs are opaque handles only the state dereferences
+namespace ConditionEvaluator
+{
+	using Form = const struct FormHandle*;
+	using Item = struct ItemHandle*;
+	using Subject = struct SubjectHandle*;
+
+	enum class Op : std::uint8_t
+	{
+		kFallback,
+		kGetGlobalValue,
+		kGetCurrentTime,
+		kIsInInterior,
+		kGetInCell,
+		kGetInWorldspace,
+		kHasKeyword
+	};
+
+	// same values as CONDITION_ITEM_DATA::OpCode
+	enum class OpCode : std::uint8_t
+	{
+		kEqualTo,
+		kNotEqualTo,
+		kGreaterThan,
+		kGreaterThanOrEqualTo,
+		kLessThan,
+		kLessThanOrEqualTo
+	};
+
+	struct Instruction
+	{
+		Op     op{ Op::kFallback };
+		OpCode opCode{ OpCode::kEqualTo };
+		bool   isOR{ false };
+		float  value{ 0.0f };
+		Form   form{ nullptr };
+		Item   item{ nullptr };
+	};
+
+	inline bool Compare(float a_lhs, OpCode a_opCode, float a_rhs)
+	{
+		switch (a_opCode) {
+		case OpCode::kEqualTo:
+			return a_lhs == a_rhs;
+		case OpCode::kNotEqualTo:
+			return a_lhs != a_rhs;
+		case OpCode::kGreaterThan:
+			return a_lhs > a_rhs;
+		case OpCode::kGreaterThanOrEqualTo:
+			return a_lhs >= a_rhs;
+		case OpCode::kLessThan:
+			return a_lhs < a_rhs;
+		case OpCode::kLessThanOrEqualTo:
+			return a_lhs <= a_rhs;
+		default:
+			return false;
+		}
+	}
+
+	// State answers every query below for the handles it was given, ConditionProgram::GameState reads them from the game
+	template <class State>
+	bool Test(const Instruction& a_instruction, Subject a_subject, const State& a_state)
+	{
+		const auto compare = [&](float a_result) {
+			return Compare(a_result, a_instruction.opCode, a_instruction.value);
+		};
+
+		switch (a_instruction.op) {
+		case Op::kGetGlobalValue:
+			return compare(a_state.GetGlobalValue(a_instruction.form));
+		case Op::kGetCurrentTime:
+			return compare(a_state.GetCurrentTime());
+		case Op::kIsInInterior:
+			return compare(a_state.IsInInterior(a_subject) ? 1.0f : 0.0f);
+		case Op::kGetInCell:
+			return compare(a_state.GetParentCell(a_subject) == a_instruction.form ? 1.0f : 0.0f);
+		case Op::kGetInWorldspace:
+			return compare(a_state.GetWorldspace(a_subject) == a_instruction.form ? 1.0f : 0.0f);
+		case Op::kHasKeyword:
+			return compare(a_state.HasKeyword(a_subject, a_instruction.form) ? 1.0f : 0.0f);
+		default:
+			return a_state.IsTrue(a_instruction.item, a_subject);
+		}
+	}
+
+	// same grouping as TESCondition::IsTrue : consecutive OR items form one term, terms are ANDed
+	template <class State>
+	bool Evaluate(std::span<const Instruction> a_instructions, Subject a_subject, const State& a_state)
+	{
+		bool orResult = false;
+		bool pendingOR = false;
+
+		for (const auto& instruction : a_instructions) {
+			if (instruction.isOR) {
+				if (!orResult) {
+					orResult = Test(instruction, a_subject, a_state);
+				}
+				pendingOR = true;
+				continue;
+			}
+			if (!orResult && !Test(instruction, a_subject, a_state)) {
+				return false;
+			}
+			orResult = false;
+			pendingOR = false;
+		}
+
+		return !pendingOR || orResult;
+	}
+}
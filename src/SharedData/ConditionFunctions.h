@@ -0,0 +1,1005 @@
+#pragma once
+
+#include "StaticStringMap.h"
+
+// condition function names and parameter types, written against FUNC_ID and PARAM_TYPE alone
+// so the tables can be built and timed without the game headers
+namespace ConditionFunctions
+{
+	inline constexpr StaticStringMap ids{ std::to_array<std::pair<std::string_view, std::uint16_t>>({
+		{ "GetWantBlocking"sv, 0 },
+		{ "GetDistance"sv, 1 },
+		{ "GetLocked"sv, 5 },
+		{ "GetPos"sv, 6 },
+		{ "GetAngle"sv, 8 },
+		{ "GetStartingPos"sv, 10 },
+		{ "GetStartingAngle"sv, 11 },
+		{ "GetSecondsPassed"sv, 12 },
+		{ "GetActorValue"sv, 14 },
+		{ "GetCurrentTime"sv, 18 },
+		{ "GetScale"sv, 24 },
+		{ "IsMoving"sv, 25 },
+		{ "IsTurning"sv, 26 },
+		{ "GetLineOfSight"sv, 27 },
+		{ "GetInSameCell"sv, 32 },
+		{ "GetDisabled"sv, 35 },
+		{ "MenuMode"sv, 36 },
+		{ "GetDisease"sv, 39 },
+		{ "GetClothingValue"sv, 41 },
+		{ "SameFaction"sv, 42 },
+		{ "SameRace"sv, 43 },
+		{ "SameSex"sv, 44 },
+		{ "GetDetected"sv, 45 },
+		{ "GetDead"sv, 46 },
+		{ "GetItemCount"sv, 47 },
+		{ "GetGold"sv, 48 },
+		{ "GetSleeping"sv, 49 },
+		{ "GetTalkedToPC"sv, 50 },
+		{ "GetScriptVariable"sv, 53 },
+		{ "GetQuestRunning"sv, 56 },
+		{ "GetStage"sv, 58 },
+		{ "GetStageDone"sv, 59 },
+		{ "GetFactionRankDifference"sv, 60 },
+		{ "GetAlarmed"sv, 61 },
+		{ "IsRaining"sv, 62 },
+		{ "GetAttacked"sv, 63 },
+		{ "GetIsCreature"sv, 64 },
+		{ "GetLockLevel"sv, 65 },
+		{ "GetShouldAttack"sv, 66 },
+		{ "GetInCell"sv, 67 },
+		{ "GetIsClass"sv, 68 },
+		{ "GetIsRace"sv, 69 },
+		{ "GetIsSex"sv, 70 },
+		{ "GetInFaction"sv, 71 },
+		{ "GetIsID"sv, 72 },
+		{ "GetFactionRank"sv, 73 },
+		{ "GetGlobalValue"sv, 74 },
+		{ "IsSnowing"sv, 75 },
+		{ "GetRandomPercent"sv, 77 },
+		{ "GetQuestVariable"sv, 79 },
+		{ "GetLevel"sv, 80 },
+		{ "IsRotating"sv, 81 },
+		{ "GetDeadCount"sv, 84 },
+		{ "GetIsAlerted"sv, 91 },
+		{ "GetPlayerControlsDisabled"sv, 98 },
+		{ "GetHeadingAngle"sv, 99 },
+		{ "IsWeaponMagicOut"sv, 101 },
+		{ "IsTorchOut"sv, 102 },
+		{ "IsShieldOut"sv, 103 },
+		{ "IsFacingUp"sv, 106 },
+		{ "GetKnockedState"sv, 107 },
+		{ "GetWeaponAnimType"sv, 108 },
+		{ "IsWeaponSkillType"sv, 109 },
+		{ "GetCurrentAIPackage"sv, 110 },
+		{ "IsWaiting"sv, 111 },
+		{ "IsIdlePlaying"sv, 112 },
+		{ "IsIntimidatedbyPlayer"sv, 116 },
+		{ "IsPlayerInRegion"sv, 117 },
+		{ "GetActorAggroRadiusViolated"sv, 118 },
+		{ "GetCrime"sv, 122 },
+		{ "IsGreetingPlayer"sv, 123 },
+		{ "IsGuard"sv, 125 },
+		{ "HasBeenEaten"sv, 127 },
+		{ "GetStaminaPercentage"sv, 128 },
+		{ "GetPCIsClass"sv, 129 },
+		{ "GetPCIsRace"sv, 130 },
+		{ "GetPCIsSex"sv, 131 },
+		{ "GetPCInFaction"sv, 132 },
+		{ "SameFactionAsPC"sv, 133 },
+		{ "SameRaceAsPC"sv, 134 },
+		{ "SameSexAsPC"sv, 135 },
+		{ "GetIsReference"sv, 136 },
+		{ "IsTalking"sv, 141 },
+		{ "GetWalkSpeed"sv, 142 },
+		{ "GetCurrentAIProcedure"sv, 143 },
+		{ "GetTrespassWarningLevel"sv, 144 },
+		{ "IsTrespassing"sv, 145 },
+		{ "IsInMyOwnedCell"sv, 146 },
+		{ "GetWindSpeed"sv, 147 },
+		{ "GetCurrentWeatherPercent"sv, 148 },
+		{ "GetIsCurrentWeather"sv, 149 },
+		{ "IsContinuingPackagePCNear"sv, 150 },
+		{ "GetIsCrimeFaction"sv, 152 },
+		{ "CanHaveFlames"sv, 153 },
+		{ "HasFlames"sv, 154 },
+		{ "GetOpenState"sv, 157 },
+		{ "GetSitting"sv, 159 },
+		{ "GetIsCurrentPackage"sv, 161 },
+		{ "IsCurrentFurnitureRef"sv, 162 },
+		{ "IsCurrentFurnitureObj"sv, 163 },
+		{ "GetDayOfWeek"sv, 170 },
+		{ "GetTalkedToPCParam"sv, 172 },
+		{ "IsPCSleeping"sv, 175 },
+		{ "IsPCAMurderer"sv, 176 },
+		{ "HasSameEditorLocAsRef"sv, 180 },
+		{ "HasSameEditorLocAsRefAlias"sv, 181 },
+		{ "GetEquipped"sv, 182 },
+		{ "IsSwimming"sv, 185 },
+		{ "GetAmountSoldStolen"sv, 190 },
+		{ "GetIgnoreCrime"sv, 192 },
+		{ "GetPCExpelled"sv, 193 },
+		{ "GetPCFactionMurder"sv, 195 },
+		{ "GetPCEnemyofFaction"sv, 197 },
+		{ "GetPCFactionAttack"sv, 199 },
+		{ "GetDestroyed"sv, 203 },
+		{ "HasMagicEffect"sv, 214 },
+		{ "GetDefaultOpen"sv, 215 },
+		{ "GetAnimAction"sv, 219 },
+		{ "IsSpellTarget"sv, 223 },
+		{ "GetVATSMode"sv, 224 },
+		{ "GetPersuasionNumber"sv, 225 },
+		{ "GetVampireFeed"sv, 226 },
+		{ "GetCannibal"sv, 227 },
+		{ "GetIsClassDefault"sv, 228 },
+		{ "GetClassDefaultMatch"sv, 229 },
+		{ "GetInCellParam"sv, 230 },
+		{ "GetVatsTargetHeight"sv, 235 },
+		{ "GetIsGhost"sv, 237 },
+		{ "GetUnconscious"sv, 242 },
+		{ "GetRestrained"sv, 244 },
+		{ "GetIsUsedItem"sv, 246 },
+		{ "GetIsUsedItemType"sv, 247 },
+		{ "IsScenePlaying"sv, 248 },
+		{ "IsInDialogueWithPlayer"sv, 249 },
+		{ "GetLocationCleared"sv, 250 },
+		{ "GetIsPlayableRace"sv, 254 },
+		{ "GetOffersServicesNow"sv, 255 },
+		{ "HasAssociationType"sv, 258 },
+		{ "HasFamilyRelationship"sv, 259 },
+		{ "HasParentRelationship"sv, 261 },
+		{ "IsWarningAbout"sv, 262 },
+		{ "IsWeaponOut"sv, 263 },
+		{ "HasSpell"sv, 264 },
+		{ "IsTimePassing"sv, 265 },
+		{ "IsPleasant"sv, 266 },
+		{ "IsCloudy"sv, 267 },
+		{ "IsSmallBump"sv, 274 },
+		{ "GetBaseActorValue"sv, 277 },
+		{ "IsOwner"sv, 278 },
+		{ "IsCellOwner"sv, 280 },
+		{ "IsHorseStolen"sv, 282 },
+		{ "IsLeftUp"sv, 285 },
+		{ "IsSneaking"sv, 286 },
+		{ "IsRunning"sv, 287 },
+		{ "GetFriendHit"sv, 288 },
+		{ "IsInCombat"sv, 289 },
+		{ "IsInInterior"sv, 300 },
+		{ "IsWaterObject"sv, 304 },
+		{ "GetPlayerAction"sv, 305 },
+		{ "IsActorUsingATorch"sv, 306 },
+		{ "IsXBox"sv, 309 },
+		{ "GetInWorldspace"sv, 310 },
+		{ "GetPCMiscStat"sv, 312 },
+		{ "GetPairedAnimation"sv, 313 },
+		{ "IsActorAVictim"sv, 314 },
+		{ "GetTotalPersuasionNumber"sv, 315 },
+		{ "GetIdleDoneOnce"sv, 318 },
+		{ "GetNoRumors"sv, 320 },
+		{ "GetCombatState"sv, 323 },
+		{ "GetWithinPackageLocation"sv, 325 },
+		{ "IsRidingMount"sv, 327 },
+		{ "IsFleeing"sv, 329 },
+		{ "IsInDangerousWater"sv, 332 },
+		{ "GetIgnoreFriendlyHits"sv, 338 },
+		{ "IsPlayersLastRiddenMount"sv, 339 },
+		{ "IsActor"sv, 353 },
+		{ "IsEssential"sv, 354 },
+		{ "IsPlayerMovingIntoNewSpace"sv, 358 },
+		{ "GetInCurrentLoc"sv, 359 },
+		{ "GetInCurrentLocAlias"sv, 360 },
+		{ "GetTimeDead"sv, 361 },
+		{ "HasLinkedRef"sv, 362 },
+		{ "IsChild"sv, 365 },
+		{ "GetStolenItemValueNoCrime"sv, 366 },
+		{ "GetLastPlayerAction"sv, 367 },
+		{ "IsPlayerActionActive"sv, 368 },
+		{ "IsTalkingActivatorActor"sv, 370 },
+		{ "IsInList"sv, 372 },
+		{ "GetStolenItemValue"sv, 373 },
+		{ "GetCrimeGoldViolent"sv, 375 },
+		{ "GetCrimeGoldNonviolent"sv, 376 },
+		{ "HasShout"sv, 378 },
+		{ "GetHasNote"sv, 381 },
+		{ "GetHitLocation"sv, 390 },
+		{ "IsPC1stPerson"sv, 391 },
+		{ "GetCauseofDeath"sv, 396 },
+		{ "IsLimbGone"sv, 397 },
+		{ "IsWeaponInList"sv, 398 },
+		{ "IsBribedbyPlayer"sv, 402 },
+		{ "GetRelationshipRank"sv, 403 },
+		{ "GetVATSValue"sv, 407 },
+		{ "IsKiller"sv, 408 },
+		{ "IsKillerObject"sv, 409 },
+		{ "GetFactionCombatReaction"sv, 410 },
+		{ "Exists"sv, 414 },
+		{ "GetGroupMemberCount"sv, 415 },
+		{ "GetGroupTargetCount"sv, 416 },
+		{ "GetIsVoiceType"sv, 426 },
+		{ "GetPlantedExplosive"sv, 427 },
+		{ "IsScenePackageRunning"sv, 429 },
+		{ "GetHealthPercentage"sv, 430 },
+		{ "GetIsObjectType"sv, 432 },
+		{ "GetDialogueEmotion"sv, 434 },
+		{ "GetDialogueEmotionValue"sv, 435 },
+		{ "GetIsCreatureType"sv, 437 },
+		{ "GetInCurrentLocFormList"sv, 444 },
+		{ "GetInZone"sv, 445 },
+		{ "GetVelocity"sv, 446 },
+		{ "GetGraphVariableFloat"sv, 447 },
+		{ "HasPerk"sv, 448 },
+		{ "GetFactionRelation"sv, 449 },
+		{ "IsLastIdlePlayed"sv, 450 },
+		{ "GetPlayerTeammate"sv, 453 },
+		{ "GetPlayerTeammateCount"sv, 454 },
+		{ "GetActorCrimePlayerEnemy"sv, 458 },
+		{ "GetCrimeGold"sv, 459 },
+		{ "IsPlayerGrabbedRef"sv, 463 },
+		{ "GetKeywordItemCount"sv, 465 },
+		{ "GetDestructionStage"sv, 470 },
+		{ "GetIsAlignment"sv, 473 },
+		{ "IsProtected"sv, 476 },
+		{ "GetThreatRatio"sv, 477 },
+		{ "GetIsUsedItemEquipType"sv, 479 },
+		{ "IsCarryable"sv, 487 },
+		{ "GetConcussed"sv, 488 },
+		{ "GetMapMarkerVisible"sv, 491 },
+		{ "PlayerKnows"sv, 493 },
+		{ "GetPermanentActorValue"sv, 494 },
+		{ "GetKillingBlowLimb"sv, 495 },
+		{ "CanPayCrimeGold"sv, 497 },
+		{ "GetDaysInJail"sv, 499 },
+		{ "EPAlchemyGetMakingPoison"sv, 500 },
+		{ "EPAlchemyEffectHasKeyword"sv, 501 },
+		{ "GetAllowWorldInteractions"sv, 503 },
+		{ "GetLastHitCritical"sv, 508 },
+		{ "IsCombatTarget"sv, 513 },
+		{ "GetVATSRightAreaFree"sv, 515 },
+		{ "GetVATSLeftAreaFree"sv, 516 },
+		{ "GetVATSBackAreaFree"sv, 517 },
+		{ "GetVATSFrontAreaFree"sv, 518 },
+		{ "GetLockIsBroken"sv, 519 },
+		{ "IsPS3"sv, 520 },
+		{ "IsWin32"sv, 521 },
+		{ "GetVATSRightTargetVisible"sv, 522 },
+		{ "GetVATSLeftTargetVisible"sv, 523 },
+		{ "GetVATSBackTargetVisible"sv, 524 },
+		{ "GetVATSFrontTargetVisible"sv, 525 },
+		{ "IsInCriticalStage"sv, 528 },
+		{ "GetXPForNextLevel"sv, 530 },
+		{ "GetInfamy"sv, 533 },
+		{ "GetInfamyViolent"sv, 534 },
+		{ "GetInfamyNonViolent"sv, 535 },
+		{ "GetQuestCompleted"sv, 543 },
+		{ "IsGoreDisabled"sv, 547 },
+		{ "IsSceneActionComplete"sv, 550 },
+		{ "GetSpellUsageNum"sv, 552 },
+		{ "GetActorsInHigh"sv, 554 },
+		{ "HasLoaded3D"sv, 555 },
+		{ "HasKeyword"sv, 560 },
+		{ "HasRefType"sv, 561 },
+		{ "LocationHasKeyword"sv, 562 },
+		{ "LocationHasRefType"sv, 563 },
+		{ "GetIsEditorLocation"sv, 565 },
+		{ "GetIsAliasRef"sv, 566 },
+		{ "GetIsEditorLocAlias"sv, 567 },
+		{ "IsSprinting"sv, 568 },
+		{ "IsBlocking"sv, 569 },
+		{ "HasEquippedSpell"sv, 570 },
+		{ "GetCurrentCastingType"sv, 571 },
+		{ "GetCurrentDeliveryType"sv, 572 },
+		{ "GetAttackState"sv, 574 },
+		{ "GetEventData"sv, 576 },
+		{ "IsCloserToAThanB"sv, 577 },
+		{ "GetEquippedShout"sv, 579 },
+		{ "IsBleedingOut"sv, 580 },
+		{ "GetRelativeAngle"sv, 584 },
+		{ "GetMovementDirection"sv, 589 },
+		{ "IsInScene"sv, 590 },
+		{ "GetRefTypeDeadCount"sv, 591 },
+		{ "GetRefTypeAliveCount"sv, 592 },
+		{ "GetIsFlying"sv, 594 },
+		{ "IsCurrentSpell"sv, 595 },
+		{ "SpellHasKeyword"sv, 596 },
+		{ "GetEquippedItemType"sv, 597 },
+		{ "GetLocationAliasCleared"sv, 598 },
+		{ "GetLocAliasRefTypeDeadCount"sv, 600 },
+		{ "GetLocAliasRefTypeAliveCount"sv, 601 },
+		{ "IsWardState"sv, 602 },
+		{ "IsInSameCurrentLocAsRef"sv, 603 },
+		{ "IsInSameCurrentLocAsRefAlias"sv, 604 },
+		{ "LocAliasIsLocation"sv, 605 },
+		{ "GetKeywordDataForLocation"sv, 606 },
+		{ "GetKeywordDataForAlias"sv, 608 },
+		{ "LocAliasHasKeyword"sv, 610 },
+		{ "IsNullPackageData"sv, 611 },
+		{ "GetNumericPackageData"sv, 612 },
+		{ "IsFurnitureAnimType"sv, 613 },
+		{ "IsFurnitureEntryType"sv, 614 },
+		{ "GetHighestRelationshipRank"sv, 615 },
+		{ "GetLowestRelationshipRank"sv, 616 },
+		{ "HasAssociationTypeAny"sv, 617 },
+		{ "HasFamilyRelationshipAny"sv, 618 },
+		{ "GetPathingTargetOffset"sv, 619 },
+		{ "GetPathingTargetAngleOffset"sv, 620 },
+		{ "GetPathingTargetSpeed"sv, 621 },
+		{ "GetPathingTargetSpeedAngle"sv, 622 },
+		{ "GetMovementSpeed"sv, 623 },
+		{ "GetInContainer"sv, 624 },
+		{ "IsLocationLoaded"sv, 625 },
+		{ "IsLocAliasLoaded"sv, 626 },
+		{ "IsDualCasting"sv, 627 },
+		{ "GetVMQuestVariable"sv, 629 },
+		{ "GetVMScriptVariable"sv, 630 },
+		{ "IsEnteringInteractionQuick"sv, 631 },
+		{ "IsCasting"sv, 632 },
+		{ "GetFlyingState"sv, 633 },
+		{ "IsInFavorState"sv, 635 },
+		{ "HasTwoHandedWeaponEquipped"sv, 636 },
+		{ "IsExitingInstant"sv, 637 },
+		{ "IsInFriendStateWithPlayer"sv, 638 },
+		{ "GetWithinDistance"sv, 639 },
+		{ "GetActorValuePercent"sv, 640 },
+		{ "IsUnique"sv, 641 },
+		{ "GetLastBumpDirection"sv, 642 },
+		{ "IsInFurnitureState"sv, 644 },
+		{ "GetIsInjured"sv, 645 },
+		{ "GetIsCrashLandRequest"sv, 646 },
+		{ "GetIsHastyLandRequest"sv, 647 },
+		{ "IsLinkedTo"sv, 650 },
+		{ "GetKeywordDataForCurrentLocation"sv, 651 },
+		{ "GetInSharedCrimeFaction"sv, 652 },
+		{ "GetBribeSuccess"sv, 654 },
+		{ "GetIntimidateSuccess"sv, 655 },
+		{ "GetArrestedState"sv, 656 },
+		{ "GetArrestingActor"sv, 657 },
+		{ "EPTemperingItemIsEnchanted"sv, 659 },
+		{ "EPTemperingItemHasKeyword"sv, 660 },
+		{ "GetReplacedItemType"sv, 664 },
+		{ "IsAttacking"sv, 672 },
+		{ "IsPowerAttacking"sv, 673 },
+		{ "IsLastHostileActor"sv, 674 },
+		{ "GetGraphVariableInt"sv, 675 },
+		{ "GetCurrentShoutVariation"sv, 676 },
+		{ "ShouldAttackKill"sv, 678 },
+		{ "GetActivatorHeight"sv, 680 },
+		{ "EPMagic_IsAdvanceSkill"sv, 681 },
+		{ "WornHasKeyword"sv, 682 },
+		{ "GetPathingCurrentSpeed"sv, 683 },
+		{ "GetPathingCurrentSpeedAngle"sv, 684 },
+		{ "EPModSkillUsage_AdvanceObjectHasKeyword"sv, 691 },
+		{ "EPModSkillUsage_IsAdvanceAction"sv, 692 },
+		{ "EPMagic_SpellHasKeyword"sv, 693 },
+		{ "GetNoBleedoutRecovery"sv, 694 },
+		{ "EPMagic_SpellHasSkill"sv, 696 },
+		{ "IsAttackType"sv, 697 },
+		{ "IsAllowedToFly"sv, 698 },
+		{ "HasMagicEffectKeyword"sv, 699 },
+		{ "IsCommandedActor"sv, 700 },
+		{ "IsStaggered"sv, 701 },
+		{ "IsRecoiling"sv, 702 },
+		{ "IsExitingInteractionQuick"sv, 703 },
+		{ "IsPathing"sv, 704 },
+		{ "GetShouldHelp"sv, 705 },
+		{ "HasBoundWeaponEquipped"sv, 706 },
+		{ "GetCombatTargetHasKeyword"sv, 707 },
+		{ "GetCombatGroupMemberCount"sv, 709 },
+		{ "IsIgnoringCombat"sv, 710 },
+		{ "GetLightLevel"sv, 711 },
+		{ "SpellHasCastingPerk"sv, 713 },
+		{ "IsBeingRidden"sv, 714 },
+		{ "IsUndead"sv, 715 },
+		{ "GetRealHoursPassed"sv, 716 },
+		{ "IsUnlockedDoor"sv, 718 },
+		{ "IsHostileToActor"sv, 719 },
+		{ "GetTargetHeight"sv, 720 },
+		{ "IsPoison"sv, 721 },
+		{ "WornApparelHasKeywordCount"sv, 722 },
+		{ "GetItemHealthPercent"sv, 723 },
+		{ "EffectWasDualCast"sv, 724 },
+		{ "GetKnockedStateEnum"sv, 725 },
+		{ "DoesNotExist"sv, 726 },
+		{ "IsOnFlyingMount"sv, 730 },
+		{ "CanFlyHere"sv, 731 },
+		{ "IsFlyingMountPatrolQueud"sv, 732 },
+		{ "IsFlyingMountFastTravelling"sv, 733 },
+		{ "IsOverEncumbered"sv, 734 },
+		{ "GetActorWarmth"sv, 735 },
+		{ "GetSKSEVersion"sv, 1024 },
+		{ "GetSKSEVersionMinor"sv, 1025 },
+		{ "GetSKSEVersionBeta"sv, 1026 },
+		{ "GetSKSERelease"sv, 1027 },
+		{ "ClearInvalidRegistrations"sv, 1028 } }) };
+
+	// the parameter types each function takes
+	constexpr PARAMS get_func_type(FUNC_ID a_funcID)
+	{
+		PARAMS paramPair;
+
+		switch (a_funcID) {
+		case FUNC_ID::kGetWantBlocking:
+		case FUNC_ID::kGetLocked:
+		case FUNC_ID::kGetSecondsPassed:
+		case FUNC_ID::kGetCurrentTime:
+		case FUNC_ID::kGetScale:
+		case FUNC_ID::kIsMoving:
+		case FUNC_ID::kIsTurning:
+		case FUNC_ID::kGetDisabled:
+		case FUNC_ID::kGetDisease:
+		case FUNC_ID::kGetClothingValue:
+		case FUNC_ID::kGetDead:
+		case FUNC_ID::kGetGold:
+		case FUNC_ID::kGetSleeping:
+		case FUNC_ID::kGetTalkedToPC:
+		case FUNC_ID::kGetAlarmed:
+		case FUNC_ID::kIsRaining:
+		case FUNC_ID::kGetAttacked:
+		case FUNC_ID::kGetIsCreature:
+		case FUNC_ID::kGetLockLevel:
+		case FUNC_ID::kIsSnowing:
+		case FUNC_ID::kGetRandomPercent:
+		case FUNC_ID::kGetLevel:
+		case FUNC_ID::kIsRotating:
+		case FUNC_ID::kGetIsAlerted:
+		case FUNC_ID::kIsWeaponMagicOut:
+		case FUNC_ID::kIsTorchOut:
+		case FUNC_ID::kIsShieldOut:
+		case FUNC_ID::kIsFacingUp:
+		case FUNC_ID::kGetKnockedState:
+		case FUNC_ID::kGetWeaponAnimType:
+		case FUNC_ID::kGetCurrentAIPackage:
+		case FUNC_ID::kIsWaiting:
+		case FUNC_ID::kIsIdlePlaying:
+		case FUNC_ID::kIsIntimidatedByPlayer:
+		case FUNC_ID::kGetActorAggroRadiusViolated:
+		case FUNC_ID::kIsGreetingPlayer:
+		case FUNC_ID::kIsGuard:
+		case FUNC_ID::kHasBeenEaten:
+		case FUNC_ID::kGetStaminaPercentage:
+		case FUNC_ID::kSameFactionAsPC:
+		case FUNC_ID::kSameRaceAsPC:
+		case FUNC_ID::kSameSexAsPC:
+		case FUNC_ID::kIsTalking:
+		case FUNC_ID::kGetWalkSpeed:
+		case FUNC_ID::kGetCurrentAIProcedure:
+		case FUNC_ID::kGetTrespassWarningLevel:
+		case FUNC_ID::kIsTrespassing:
+		case FUNC_ID::kIsInMyOwnedCell:
+		case FUNC_ID::kGetWindSpeed:
+		case FUNC_ID::kGetCurrentWeatherPercent:
+		case FUNC_ID::kIsContinuingPackagePCNear:
+		case FUNC_ID::kCanHaveFlames:
+		case FUNC_ID::kHasFlames:
+		case FUNC_ID::kGetOpenState:
+		case FUNC_ID::kGetSitting:
+		case FUNC_ID::kGetDayOfWeek:
+		case FUNC_ID::kIsPCSleeping:
+		case FUNC_ID::kIsPCAMurderer:
+		case FUNC_ID::kIsSwimming:
+		case FUNC_ID::kGetAmountSoldStolen:
+		case FUNC_ID::kGetIgnoreCrime:
+		case FUNC_ID::kGetDestroyed:
+		case FUNC_ID::kGetDefaultOpen:
+		case FUNC_ID::kGetAnimAction:
+		case FUNC_ID::kGetVATSMode:
+		case FUNC_ID::kGetPersuasionNumber:
+		case FUNC_ID::kGetVampireFeed:
+		case FUNC_ID::kGetCannibal:
+		case FUNC_ID::kGetClassDefaultMatch:
+		case FUNC_ID::kGetVatsTargetHeight:
+		case FUNC_ID::kGetIsGhost:
+		case FUNC_ID::kGetUnconscious:
+		case FUNC_ID::kGetRestrained:
+		case FUNC_ID::kIsInDialogueWithPlayer:
+		case FUNC_ID::kGetIsPlayableRace:
+		case FUNC_ID::kGetOffersServicesNow:
+		case FUNC_ID::kIsWeaponOut:
+		case FUNC_ID::kIsTimePassing:
+		case FUNC_ID::kIsPleasant:
+		case FUNC_ID::kIsCloudy:
+		case FUNC_ID::kIsSmallBump:
+		case FUNC_ID::kIsHorseStolen:
+		case FUNC_ID::kIsLeftUp:
+		case FUNC_ID::kIsSneaking:
+		case FUNC_ID::kIsRunning:
+		case FUNC_ID::kGetFriendHit:
+		case FUNC_ID::kIsInInterior:
+		case FUNC_ID::kIsWaterObject:
+		case FUNC_ID::kGetPlayerAction:
+		case FUNC_ID::kIsActorUsingATorch:
+		case FUNC_ID::kIsXBox:
+		case FUNC_ID::kGetPairedAnimation:
+		case FUNC_ID::kIsActorAVictim:
+		case FUNC_ID::kGetTotalPersuasionNumber:
+		case FUNC_ID::kGetIdleDoneOnce:
+		case FUNC_ID::kGetNoRumors:
+		case FUNC_ID::kGetCombatState:
+		case FUNC_ID::kIsRidingMount:
+		case FUNC_ID::kIsFleeing:
+		case FUNC_ID::kIsInDangerousWater:
+		case FUNC_ID::kGetIgnoreFriendlyHits:
+		case FUNC_ID::kIsPlayersLastRiddenMount:
+		case FUNC_ID::kIsActor:
+		case FUNC_ID::kIsEssential:
+		case FUNC_ID::kIsPlayerMovingIntoNewSpace:
+		case FUNC_ID::kGetTimeDead:
+		case FUNC_ID::kIsChild:
+		case FUNC_ID::kGetLastPlayerAction:
+		case FUNC_ID::kGetCrimeGoldViolent:
+		case FUNC_ID::kGetCrimeGoldNonviolent:
+		case FUNC_ID::kGetHitLocation:
+		case FUNC_ID::kIsPC1stPerson:
+		case FUNC_ID::kGetCauseofDeath:
+		case FUNC_ID::kIsBribedbyPlayer:
+		case FUNC_ID::kGetGroupMemberCount:
+		case FUNC_ID::kGetGroupTargetCount:
+		case FUNC_ID::kGetPlantedExplosive:
+		case FUNC_ID::kIsScenePackageRunning:
+		case FUNC_ID::kGetHealthPercentage:
+		case FUNC_ID::kGetDialogueEmotion:
+		case FUNC_ID::kGetDialogueEmotionValue:
+		case FUNC_ID::kGetPlayerTeammate:
+		case FUNC_ID::kGetPlayerTeammateCount:
+		case FUNC_ID::kGetActorCrimePlayerEnemy:
+		case FUNC_ID::kGetCrimeGold:
+		case FUNC_ID::kGetDestructionStage:
+		case FUNC_ID::kIsProtected:
+		case FUNC_ID::kIsCarryable:
+		case FUNC_ID::kGetConcussed:
+		case FUNC_ID::kGetMapMarkerVisible:
+		case FUNC_ID::kGetKillingBlowLimb:
+		case FUNC_ID::kCanPayCrimeGold:
+		case FUNC_ID::kGetDaysInJail:
+		case FUNC_ID::kEPAlchemyGetMakingPoison:
+		case FUNC_ID::kGetAllowWorldInteractions:
+		case FUNC_ID::kGetLastHitCritical:
+		case FUNC_ID::kGetIsLockBroken:
+		case FUNC_ID::kIsPS3:
+		case FUNC_ID::kIsWin32:
+		case FUNC_ID::kGetXPForNextLevel:
+		case FUNC_ID::kGetInfamy:
+		case FUNC_ID::kGetInfamyViolent:
+		case FUNC_ID::kGetInfamyNonViolent:
+		case FUNC_ID::kIsGoreDisabled:
+		case FUNC_ID::kGetActorsInHigh:
+		case FUNC_ID::kHasLoaded3D:
+		case FUNC_ID::kIsSprinting:
+		case FUNC_ID::kIsBlocking:
+		case FUNC_ID::kGetAttackState:
+		case FUNC_ID::kIsBleedingOut:
+		case FUNC_ID::kGetMovementDirection:
+		case FUNC_ID::kIsInScene:
+		case FUNC_ID::kGetIsFlying:
+		case FUNC_ID::kGetHighestRelationshipRank:
+		case FUNC_ID::kGetLowestRelationshipRank:
+		case FUNC_ID::kHasFamilyRelationshipAny:
+		case FUNC_ID::kGetPathingTargetSpeed:
+		case FUNC_ID::kGetMovementSpeed:
+		case FUNC_ID::kIsDualCasting:
+		case FUNC_ID::kIsEnteringInteractionQuick:
+		case FUNC_ID::kIsCasting:
+		case FUNC_ID::kGetFlyingState:
+		case FUNC_ID::kIsInFavorState:
+		case FUNC_ID::kHasTwoHandedWeaponEquipped:
+		case FUNC_ID::kIsExitingInstant:
+		case FUNC_ID::kIsInFriendStateWithPlayer:
+		case FUNC_ID::kIsUnique:
+		case FUNC_ID::kGetLastBumpDirection:
+		case FUNC_ID::kGetIsInjured:
+		case FUNC_ID::kGetIsCrashLandRequest:
+		case FUNC_ID::kGetIsHastyLandRequest:
+		case FUNC_ID::kGetBribeSuccess:
+		case FUNC_ID::kGetIntimidateSuccess:
+		case FUNC_ID::kGetArrestedState:
+		case FUNC_ID::kGetArrestingActor:
+		case FUNC_ID::kEPTemperingItemIsEnchanted:
+		case FUNC_ID::kIsAttacking:
+		case FUNC_ID::kIsPowerAttacking:
+		case FUNC_ID::kIsLastHostileActor:
+		case FUNC_ID::kGetCurrentShoutVariation:
+		case FUNC_ID::kGetActivationHeight:
+		case FUNC_ID::kGetPathingCurrentSpeed:
+		case FUNC_ID::kGetNoBleedoutRecovery:
+		case FUNC_ID::kIsAllowedToFly:
+		case FUNC_ID::kIsCommandedActor:
+		case FUNC_ID::kIsStaggered:
+		case FUNC_ID::kIsRecoiling:
+		case FUNC_ID::kIsExitingInteractionQuick:
+		case FUNC_ID::kIsPathing:
+		case FUNC_ID::kGetCombatGroupMemberCount:
+		case FUNC_ID::kIsIgnoringCombat:
+		case FUNC_ID::kGetLightLevel:
+		case FUNC_ID::kIsBeingRidden:
+		case FUNC_ID::kIsUndead:
+		case FUNC_ID::kGetRealHoursPassed:
+		case FUNC_ID::kIsUnlockedDoor:
+		case FUNC_ID::kIsPoison:
+		case FUNC_ID::kGetItemHealthPercent:
+		case FUNC_ID::kEffectWasDualCast:
+		case FUNC_ID::kGetKnockStateEnum:
+		case FUNC_ID::kDoesNotExist:
+		case FUNC_ID::kIsOnFlyingMount:
+		case FUNC_ID::kCanFlyHere:
+		case FUNC_ID::kIsFlyingMountPatrolQueued:
+		case FUNC_ID::kIsFlyingMountFastTravelling:
+		case FUNC_ID::kIsOverEncumbered:
+		case FUNC_ID::kGetActorWarmth:
+			paramPair = { std::nullopt, std::nullopt };
+			break;
+		case FUNC_ID::kGetDistance:
+		case FUNC_ID::kGetLineOfSight:
+		case FUNC_ID::kGetInSameCell:
+		case FUNC_ID::kGetHeadingAngle:
+		case FUNC_ID::kGetIsReference:
+		case FUNC_ID::kIsCurrentFurnitureRef:
+		case FUNC_ID::kGetRelationshipRank:
+		case FUNC_ID::kExists:
+		case FUNC_ID::kIsPlayerGrabbedRef:
+		case FUNC_ID::kGetVATSRightAreaFree:
+		case FUNC_ID::kGetVATSLeftAreaFree:
+		case FUNC_ID::kGetVATSBackAreaFree:
+		case FUNC_ID::kGetVATSFrontAreaFree:
+		case FUNC_ID::kGetVATSRightTargetVisible:
+		case FUNC_ID::kGetVATSLeftTargetVisible:
+		case FUNC_ID::kGetVATSBackTargetVisible:
+		case FUNC_ID::kGetVATSFrontTargetVisible:
+		case FUNC_ID::kGetInContainer:
+		case FUNC_ID::kGetInSharedCrimeFaction:
+		case FUNC_ID::kGetTargetHeight:
+			paramPair = { PARAM_TYPE::kObjectRef, std::nullopt };
+			break;
+		case FUNC_ID::kGetPos:
+		case FUNC_ID::kGetAngle:
+		case FUNC_ID::kGetStartingPos:
+		case FUNC_ID::kGetStartingAngle:
+		case FUNC_ID::kGetVelocity:
+		case FUNC_ID::kGetPathingTargetOffset:
+		case FUNC_ID::kGetPathingTargetAngleOffset:
+		case FUNC_ID::kGetPathingTargetSpeedAngle:
+		case FUNC_ID::kGetPathingCurrentSpeedAngle:
+			paramPair = { PARAM_TYPE::kAxis, std::nullopt };
+			break;
+		case FUNC_ID::kGetActorValue:
+		case FUNC_ID::kIsWeaponSkillType:
+		case FUNC_ID::kGetBaseActorValue:
+		case FUNC_ID::kGetPermanentActorValue:
+		case FUNC_ID::kGetActorValuePercent:
+		case FUNC_ID::kEPModSkillUsage_IsAdvanceSkill:
+		case FUNC_ID::kEPMagic_SpellHasSkill:
+			paramPair = { PARAM_TYPE::kActorValue, std::nullopt };
+			break;
+		case FUNC_ID::kMenuMode:
+		case FUNC_ID::kIsInCombat:
+		case FUNC_ID::kIsPlayerActionActive:
+		case FUNC_ID::kGetHasNote:
+		case FUNC_ID::kIsLimbGone:
+		case FUNC_ID::kGetIsCreatureType:
+		case FUNC_ID::kGetNumericPackageData:
+			paramPair = { PARAM_TYPE::kInt, std::nullopt };
+			break;
+		case FUNC_ID::kSameFaction:
+		case FUNC_ID::kSameRace:
+		case FUNC_ID::kSameSex:
+		case FUNC_ID::kGetDetected:
+		case FUNC_ID::kGetShouldAttack:
+		case FUNC_ID::kGetTalkedToPCParam:
+		case FUNC_ID::kHasFamilyRelationship:
+		case FUNC_ID::kHasParentRelationship:
+		case FUNC_ID::kIsTalkingActivatorActor:
+		case FUNC_ID::kIsKiller:
+		case FUNC_ID::kGetFactionRelation:
+		case FUNC_ID::kGetThreatRatio:
+		case FUNC_ID::kIsCombatTarget:
+		case FUNC_ID::kShouldAttackKill:
+		case FUNC_ID::kGetShouldHelp:
+		case FUNC_ID::kIsHostileToActor:
+			paramPair = { PARAM_TYPE::kActor, std::nullopt };
+			break;
+		case FUNC_ID::kGetItemCount:
+		case FUNC_ID::kGetEquipped:
+			paramPair = { PARAM_TYPE::kInvObjectOrFormList, std::nullopt };
+			break;
+		case FUNC_ID::kGetScriptVariable:
+		case FUNC_ID::kGetVMScriptVariable:
+			paramPair = { PARAM_TYPE::kObjectRef, PARAM_TYPE::kChar };
+			break;
+		case FUNC_ID::kGetQuestRunning:
+		case FUNC_ID::kGetStage:
+		case FUNC_ID::kGetQuestCompleted:
+			paramPair = { PARAM_TYPE::kQuest, std::nullopt };
+			break;
+		case FUNC_ID::kGetStageDone:
+			paramPair = { PARAM_TYPE::kQuest, PARAM_TYPE::kInt };
+			break;
+		case FUNC_ID::kGetFactionRankDifference:
+			paramPair = { PARAM_TYPE::kFaction, PARAM_TYPE::kActor };
+			break;
+		case FUNC_ID::kGetInCell:
+			paramPair = { PARAM_TYPE::kCell, std::nullopt };
+			break;
+		case FUNC_ID::kGetIsClass:
+		case FUNC_ID::kGetPCIsClass:
+		case FUNC_ID::kGetIsClassDefault:
+			paramPair = { PARAM_TYPE::kClass, std::nullopt };
+			break;
+		case FUNC_ID::kGetIsRace:
+		case FUNC_ID::kGetPCIsRace:
+			paramPair = { PARAM_TYPE::kRace, std::nullopt };
+			break;
+		case FUNC_ID::kGetIsSex:
+		case FUNC_ID::kGetPCIsSex:
+			paramPair = { PARAM_TYPE::kSex, std::nullopt };
+			break;
+		case FUNC_ID::kGetInFaction:
+		case FUNC_ID::kGetFactionRank:
+		case FUNC_ID::kGetPCInFaction:
+		case FUNC_ID::kGetIsCrimeFaction:
+		case FUNC_ID::kGetPCExpelled:
+		case FUNC_ID::kGetPCFactionMurder:
+		case FUNC_ID::kGetPCEnemyofFaction:
+		case FUNC_ID::kGetPCFactionAttack:
+		case FUNC_ID::kGetStolenItemValueNoCrime:
+		case FUNC_ID::kGetStolenItemValue:
+			paramPair = { PARAM_TYPE::kFaction, std::nullopt };
+			break;
+		case FUNC_ID::kGetIsID:
+		case FUNC_ID::kGetIsUsedItem:
+			paramPair = { PARAM_TYPE::kObjectOrFormList, std::nullopt };
+			break;
+		case FUNC_ID::kGetGlobalValue:
+			paramPair = { PARAM_TYPE::kGlobal, std::nullopt };
+			break;
+		case FUNC_ID::kGetQuestVariable:
+		case FUNC_ID::kGetVMQuestVariable:
+			paramPair = { PARAM_TYPE::kQuest, PARAM_TYPE::kChar };
+			break;
+		case FUNC_ID::kGetDeadCount:
+			paramPair = { PARAM_TYPE::kActorBase, std::nullopt };
+			break;
+		case FUNC_ID::kGetPlayerControlsDisabled:
+			paramPair = { PARAM_TYPE::kInt, PARAM_TYPE::kInt };
+			break;
+		case FUNC_ID::kIsPlayerInRegion:
+			paramPair = { PARAM_TYPE::kRegion, std::nullopt };
+			break;
+		case FUNC_ID::kGetCrime:
+			paramPair = { PARAM_TYPE::kActor, PARAM_TYPE::kCrimeType };
+			break;
+		case FUNC_ID::kGetIsCurrentWeather:
+			paramPair = { PARAM_TYPE::kWeather, std::nullopt };
+			break;
+		case FUNC_ID::kGetIsCurrentPackage:
+			paramPair = { PARAM_TYPE::kPackage, std::nullopt };
+			break;
+		case FUNC_ID::kIsCurrentFurnitureObj:
+			paramPair = { PARAM_TYPE::kFurnitureOrFormList, std::nullopt };
+			break;
+		case FUNC_ID::kHasSameEditorLocAsRef:
+		case FUNC_ID::kIsInSameCurrentLocAsRef:
+		case FUNC_ID::kIsLinkedTo:
+			paramPair = { PARAM_TYPE::kObjectRef, PARAM_TYPE::kKeyword };
+			break;
+		case FUNC_ID::kHasSameEditorLocAsRefAlias:
+		case FUNC_ID::kIsInSameCurrentLocAsRefAlias:
+		case FUNC_ID::kGetKeywordDataForAlias:
+		case FUNC_ID::kLocAliasHasKeyword:
+			paramPair = { PARAM_TYPE::kAlias, PARAM_TYPE::kKeyword };
+			break;
+		case FUNC_ID::kHasMagicEffect:
+			paramPair = { PARAM_TYPE::kMagicEffect, std::nullopt };
+			break;
+		case FUNC_ID::kIsSpellTarget:
+		case FUNC_ID::kHasSpell:
+		case FUNC_ID::kGetSpellUsageNum:
+			paramPair = { PARAM_TYPE::kMagicItem, std::nullopt };
+			break;
+		case FUNC_ID::kGetInCellParam:
+			paramPair = { PARAM_TYPE::kCell, PARAM_TYPE::kObjectRef };
+			break;
+		case FUNC_ID::kGetIsUsedItemType:
+		case FUNC_ID::kGetIsObjectType:
+			paramPair = { PARAM_TYPE::kFormType, std::nullopt };
+			break;
+		case FUNC_ID::kIsScenePlaying:
+			paramPair = { PARAM_TYPE::kBGSScene, std::nullopt };
+			break;
+		case FUNC_ID::kGetLocationCleared:
+		case FUNC_ID::kGetInCurrentLoc:
+		case FUNC_ID::kGetIsEditorLocation:
+		case FUNC_ID::kIsLocationLoaded:
+			paramPair = { PARAM_TYPE::kLocation, std::nullopt };
+			break;
+		case FUNC_ID::kHasAssociationType:
+			paramPair = { PARAM_TYPE::kActor, PARAM_TYPE::kAssociationType };
+			break;
+		case FUNC_ID::kIsWarningAbout:
+		case FUNC_ID::kIsInList:
+		case FUNC_ID::kIsWeaponInList:
+		case FUNC_ID::kIsKillerObject:
+		case FUNC_ID::kGetInCurrentLocFormList:
+			paramPair = { PARAM_TYPE::kFormList, std::nullopt };
+			break;
+		case FUNC_ID::kIsOwner:
+			paramPair = { PARAM_TYPE::kOwner, std::nullopt };
+			break;
+		case FUNC_ID::kIsCellOwner:
+			paramPair = { PARAM_TYPE::kCell, PARAM_TYPE::kOwner };
+			break;
+		case FUNC_ID::kGetInWorldspace:
+			paramPair = { PARAM_TYPE::kWorldOrList, std::nullopt };
+			break;
+		case FUNC_ID::kGetPCMiscStat:
+			paramPair = { PARAM_TYPE::kMiscStat, std::nullopt };
+			break;
+		case FUNC_ID::kGetWithinPackageLocation:
+		case FUNC_ID::kIsNullPackageData:
+			paramPair = { PARAM_TYPE::kPackageDataCanBeNull, std::nullopt };
+			break;
+		case FUNC_ID::kGetInCurrentLocAlias:
+		case FUNC_ID::kGetIsAliasRef:
+		case FUNC_ID::kGetIsEditorLocAlias:
+		case FUNC_ID::kGetLocationAliasCleared:
+		case FUNC_ID::kIsLocAliasLoaded:
+			paramPair = { PARAM_TYPE::kAlias, std::nullopt };
+			break;
+		case FUNC_ID::kHasLinkedRef:
+		case FUNC_ID::kGetKeywordItemCount:
+		case FUNC_ID::kEPAlchemyEffectHasKeyword:
+		case FUNC_ID::kHasKeyword:
+		case FUNC_ID::kLocationHasKeyword:
+		case FUNC_ID::kGetKeywordDataForCurrentLocation:
+		case FUNC_ID::kEPTemperingItemHasKeyword:
+		case FUNC_ID::kWornHasKeyword:
+		case FUNC_ID::kEPModSkillUsage_AdvanceObjectHasKeyword:
+		case FUNC_ID::kEPMagic_SpellHasKeyword:
+		case FUNC_ID::kIsAttackType:
+		case FUNC_ID::kHasMagicEffectKeyword:
+		case FUNC_ID::kGetCombatTargetHasKeyword:
+		case FUNC_ID::kWornApparelHasKeywordCount:
+			paramPair = { PARAM_TYPE::kKeyword, std::nullopt };
+			break;
+		case FUNC_ID::kHasShout:
+		case FUNC_ID::kGetEquippedShout:
+			paramPair = { PARAM_TYPE::kShout, std::nullopt };
+			break;
+		case FUNC_ID::kGetVATSValue:
+			paramPair = { PARAM_TYPE::kInt, PARAM_TYPE::kInt };
+			break;
+		case FUNC_ID::kGetFactionCombatReaction:
+			paramPair = { PARAM_TYPE::kFaction, PARAM_TYPE::kFaction };
+			break;
+		case FUNC_ID::kGetIsVoiceType:
+			paramPair = { PARAM_TYPE::kVoiceType, std::nullopt };
+			break;
+		case FUNC_ID::kGetInZone:
+			paramPair = { PARAM_TYPE::kEncounterZone, std::nullopt };
+			break;
+		case FUNC_ID::kGetGraphVariableFloat:
+		case FUNC_ID::kGetGraphVariableInt:
+			paramPair = { PARAM_TYPE::kChar, std::nullopt };
+			break;
+		case FUNC_ID::kHasPerk:
+			paramPair = { PARAM_TYPE::kPerk, PARAM_TYPE::kInt };
+			break;
+		case FUNC_ID::kIsLastIdlePlayed:
+			paramPair = { PARAM_TYPE::kIdleForm, std::nullopt };
+			break;
+		case FUNC_ID::kGetIsAlignment:
+			paramPair = { PARAM_TYPE::kAlignment, std::nullopt };
+			break;
+		case FUNC_ID::kGetIsUsedItemEquipType:
+			paramPair = { PARAM_TYPE::kEquipType, std::nullopt };
+			break;
+		case FUNC_ID::kPlayerKnows:
+			paramPair = { PARAM_TYPE::kKnowableForm, std::nullopt };
+			break;
+		case FUNC_ID::kIsInCriticalStage:
+			paramPair = { PARAM_TYPE::kCritStage, std::nullopt };
+			break;
+		case FUNC_ID::kIsSceneActionComplete:
+			paramPair = { PARAM_TYPE::kBGSScene, PARAM_TYPE::kInt };
+			break;
+		case FUNC_ID::kHasRefType:
+		case FUNC_ID::kLocationHasRefType:
+			paramPair = { PARAM_TYPE::kRefType, std::nullopt };
+			break;
+		case FUNC_ID::kHasEquippedSpell:
+		case FUNC_ID::kGetCurrentCastingType:
+		case FUNC_ID::kGetCurrentDeliveryType:
+		case FUNC_ID::kGetEquippedItemType:
+		case FUNC_ID::kGetReplacedItemType:
+		case FUNC_ID::kHasBoundWeaponEquipped:
+			paramPair = { PARAM_TYPE::kCastingSource, std::nullopt };
+			break;
+		case FUNC_ID::kGetEventData:
+			paramPair = { PARAM_TYPE::kEventFunction, PARAM_TYPE::kEventFunctionData };  // third parameter in xEdit but who cares, we're skipping this
+			break;
+		case FUNC_ID::kIsCloserToAThanB:
+			paramPair = { PARAM_TYPE::kObjectRef, PARAM_TYPE::kObjectRef };
+			break;
+		case FUNC_ID::kGetRelativeAngle:
+			paramPair = { PARAM_TYPE::kObjectRef, PARAM_TYPE::kAxis };
+			break;
+		case FUNC_ID::kGetRefTypeDeadCount:
+		case FUNC_ID::kGetRefTypeAliveCount:
+			paramPair = { PARAM_TYPE::kLocation, PARAM_TYPE::kRefType };
+			break;
+		case FUNC_ID::kIsCurrentSpell:
+			paramPair = { PARAM_TYPE::kMagicItem, PARAM_TYPE::kCastingSource };
+			break;
+		case FUNC_ID::kSpellHasKeyword:
+			paramPair = { PARAM_TYPE::kCastingSource, PARAM_TYPE::kKeyword };
+			break;
+		case FUNC_ID::kGetLocAliasRefTypeDeadCount:
+		case FUNC_ID::kGetLocAliasRefTypeAliveCount:
+			paramPair = { PARAM_TYPE::kAlias, PARAM_TYPE::kRefType };
+			break;
+		case FUNC_ID::kIsWardState:
+			paramPair = { PARAM_TYPE::kWardState, std::nullopt };
+			break;
+		case FUNC_ID::kLocAliasIsLocation:
+			paramPair = { PARAM_TYPE::kAlias, PARAM_TYPE::kLocation };
+			break;
+		case FUNC_ID::kGetKeywordDataForLocation:
+			paramPair = { PARAM_TYPE::kLocation, PARAM_TYPE::kKeyword };
+			break;
+		case FUNC_ID::kIsFurnitureAnimType:
+		case FUNC_ID::kIsInFurnitureState:
+			paramPair = { PARAM_TYPE::kFurnitureAnimType, std::nullopt };
+			break;
+		case FUNC_ID::kIsFurnitureEntryType:
+			paramPair = { PARAM_TYPE::kFurnitureEntryType, std::nullopt };
+			break;
+		case FUNC_ID::kHasAssociationTypeAny:
+			paramPair = { PARAM_TYPE::kAssociationType, std::nullopt };
+			break;
+		case FUNC_ID::kGetWithinDistance:
+			paramPair = { PARAM_TYPE::kObjectRef, PARAM_TYPE::kFloat };
+			break;
+		case FUNC_ID::kEPModSkillUsage_IsAdvanceAction:
+			paramPair = { PARAM_TYPE::kSkillAction, std::nullopt };
+			break;
+		case FUNC_ID::kSpellHasCastingPerk:
+			paramPair = { PARAM_TYPE::kPerk, std::nullopt };
+			break;
+		default:
+			paramPair = { std::nullopt, std::nullopt };
+			break;
+		}
+
+		return paramPair;
+	}
+
+	// get_func_type looked up from a table built at compile time
+	inline PARAMS GetParamTypes(FUNC_ID a_funcID)
+	{
+		static constexpr std::uint8_t none = 0xFF;
+		static constexpr std::size_t  numFuncIDs = std::ranges::max(ids.data() | std::views::values) + 1;
+
+		// param types for every function ID, packed into a byte each
+		static constexpr auto paramTable = [] {
+			const auto encode = [](std::optional<PARAM_TYPE> a_type) {
+				if (a_type && std::to_underlying(*a_type) >= none) {
+					throw "param type out of range";
+				}
+				return a_type ? static_cast<std::uint8_t>(*a_type) : none;
+			};
+
+			std::array<std::array<std::uint8_t, 2>, numFuncIDs> table{};
+			for (std::size_t i = 0; i < table.size(); ++i) {
+				const auto [param1, param2] = get_func_type(static_cast<FUNC_ID>(i));
+				table[i] = { encode(param1), encode(param2) };
+			}
+			return table;
+		}();
+
+		const auto idx = static_cast<std::size_t>(a_funcID);
+		if (idx >= paramTable.size()) {
+			return { std::nullopt, std::nullopt };
+		}
+
+		const auto decode = [](std::uint8_t a_type) -> std::optional<PARAM_TYPE> {
+			return a_type != none ? std::optional(static_cast<PARAM_TYPE>(a_type)) : std::nullopt;
+		};
+		return { decode(paramTable[idx][0]), decode(paramTable[idx][1]) };
+	}
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+// lexical split of a condition line, kept free of game types so it can be checked against the original regex on its own
+// (\w+)?\s*(\w+)\s+(\w+)(?:\s+(\w+))?\s*([=!<>]+)\s*([\d.]+)\s*(AND|OR)?
+namespace ConditionGrammar
+{
+	inline bool is_word_char(char a_ch)
+	{
+		return std::isalnum(static_cast<unsigned char>(a_ch)) || a_ch == '_';
+	}
+
+	inline bool is_op_char(char a_ch)
+	{
+		return a_ch == '=' || a_ch == '!' || a_ch == '<' || a_ch == '>';
+	}
+
+	inline bool is_value_char(char a_ch)
+	{
+		return std::isdigit(static_cast<unsigned char>(a_ch)) || a_ch == '.';
+	}
+
+	// cursor over a condition line; every token is a view into the source
+	struct Cursor
+	{
+		void skip_ws()
+		{
+			while (pos < str.size() && std::isspace(static_cast<unsigned char>(str[pos]))) {
+				++pos;
+			}
+		}
+
+		std::string_view take_while(auto a_pred)
+		{
+			const auto start = pos;
+			while (pos < str.size() && a_pred(str[pos])) {
+				++pos;
+			}
+			return str.substr(start, pos - start);
+		}
+
+		std::string_view word()
+		{
+			skip_ws();
+			return take_while(is_word_char);
+		}
+
+		bool at_end() const { return pos >= str.size(); }
+
+		// members
+		std::string_view str;
+		std::size_t      pos{ 0 };
+	};
+
+	// one view per regex capture group, empty where the group didn't participate
+	struct Match
+	{
+		std::string_view subject;
+		std::string_view function;
+		std::string_view param1;
+		std::string_view param2;
+		std::string_view opCode;
+		std::string_view value;
+		std::string_view andOr;
+	};
+
+	struct Error
+	{
+		std::size_t      pos{ 0 };
+		std::string_view reason;
+	};
+
+	// same result as regex_match with the pattern above, including how its backtracking assigns the leading words
+	inline std::optional<Match> Split(std::string_view a_condition, Error& a_error)
+	{
+		Cursor cursor{ a_condition };
+		Match  match{};
+
+		const auto fail = [&](std::size_t a_pos, std::string_view a_reason) {
+			a_error = { a_pos, a_reason };
+			return std::nullopt;
+		};
+		const auto pos_of = [&](std::string_view a_token) {
+			return static_cast<std::size_t>(a_token.data() - a_condition.data());
+		};
+
+		// the optional subject can't start on whitespace, so leading whitespace means there is none
+		const bool leadingSpace = !cursor.at_end() && std::isspace(static_cast<unsigned char>(a_condition.front()));
+
+		std::array<std::string_view, 4> words{};
+		std::size_t                     numWords = 0;
+		for (auto word = cursor.word(); !word.empty(); word = cursor.word()) {
+			if (numWords == words.size()) {
+				return fail(pos_of(word), "too many parameters"sv);
+			}
+			words[numWords++] = word;
+		}
+
+		if (numWords < 2) {
+			return fail(cursor.pos, "expected function name and parameter"sv);
+		}
+
+		if (leadingSpace) {
+			if (numWords == 4) {
+				return fail(pos_of(words[3]), "too many parameters"sv);
+			}
+			match.function = words[0];
+			match.param1 = words[1];
+			match.param2 = words[2];
+		} else if (numWords > 2) {
+			match.subject = words[0];
+			match.function = words[1];
+			match.param1 = words[2];
+			match.param2 = words[3];
+		} else if (words[0].size() > 1) {
+			// the regex backtracks the subject by one character before it gives it up, leaving a one letter function
+			match.subject = words[0].substr(0, words[0].size() - 1);
+			match.function = words[0].substr(words[0].size() - 1);
+			match.param1 = words[1];
+		} else {
+			match.function = words[0];
+			match.param1 = words[1];
+		}
+
+		// opcode
+		match.opCode = cursor.take_while(is_op_char);
+		if (match.opCode.empty()) {
+			return fail(cursor.pos, "expected comparison operator"sv);
+		}
+
+		// value
+		cursor.skip_ws();
+		match.value = cursor.take_while(is_value_char);
+		if (match.value.empty()) {
+			return fail(cursor.pos, "expected numeric value"sv);
+		}
+
+		// andOr, nothing may follow it
+		cursor.skip_ws();
+		const auto andOrPos = cursor.pos;
+		if (const auto rest = a_condition.substr(andOrPos); rest == "AND"sv || rest == "OR"sv) {
+			match.andOr = rest;
+		} else if (!rest.empty()) {
+			return fail(andOrPos, "expected AND or OR"sv);
+		}
+
+		return match;
+	}
+}
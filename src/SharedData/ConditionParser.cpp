@@ -1,576 +1,37 @@
 #include "ConditionParser.h"
 
-PARAMS ConditionParser::GetFuncType(FUNC_ID a_funcID)
-{
-	PARAMS paramPair;
+#include "ConditionFunctions.h"
+#include "ConditionGrammar.h"
 
-	switch (a_funcID) {
-	case FUNC_ID::kGetWantBlocking:
-	case FUNC_ID::kGetLocked:
-	case FUNC_ID::kGetSecondsPassed:
-	case FUNC_ID::kGetCurrentTime:
-	case FUNC_ID::kGetScale:
-	case FUNC_ID::kIsMoving:
-	case FUNC_ID::kIsTurning:
-	case FUNC_ID::kGetDisabled:
-	case FUNC_ID::kGetDisease:
-	case FUNC_ID::kGetClothingValue:
-	case FUNC_ID::kGetDead:
-	case FUNC_ID::kGetGold:
-	case FUNC_ID::kGetSleeping:
-	case FUNC_ID::kGetTalkedToPC:
-	case FUNC_ID::kGetAlarmed:
-	case FUNC_ID::kIsRaining:
-	case FUNC_ID::kGetAttacked:
-	case FUNC_ID::kGetIsCreature:
-	case FUNC_ID::kGetLockLevel:
-	case FUNC_ID::kIsSnowing:
-	case FUNC_ID::kGetRandomPercent:
-	case FUNC_ID::kGetLevel:
-	case FUNC_ID::kIsRotating:
-	case FUNC_ID::kGetIsAlerted:
-	case FUNC_ID::kIsWeaponMagicOut:
-	case FUNC_ID::kIsTorchOut:
-	case FUNC_ID::kIsShieldOut:
-	case FUNC_ID::kIsFacingUp:
-	case FUNC_ID::kGetKnockedState:
-	case FUNC_ID::kGetWeaponAnimType:
-	case FUNC_ID::kGetCurrentAIPackage:
-	case FUNC_ID::kIsWaiting:
-	case FUNC_ID::kIsIdlePlaying:
-	case FUNC_ID::kIsIntimidatedByPlayer:
-	case FUNC_ID::kGetActorAggroRadiusViolated:
-	case FUNC_ID::kIsGreetingPlayer:
-	case FUNC_ID::kIsGuard:
-	case FUNC_ID::kHasBeenEaten:
-	case FUNC_ID::kGetStaminaPercentage:
-	case FUNC_ID::kSameFactionAsPC:
-	case FUNC_ID::kSameRaceAsPC:
-	case FUNC_ID::kSameSexAsPC:
-	case FUNC_ID::kIsTalking:
-	case FUNC_ID::kGetWalkSpeed:
-	case FUNC_ID::kGetCurrentAIProcedure:
-	case FUNC_ID::kGetTrespassWarningLevel:
-	case FUNC_ID::kIsTrespassing:
-	case FUNC_ID::kIsInMyOwnedCell:
-	case FUNC_ID::kGetWindSpeed:
-	case FUNC_ID::kGetCurrentWeatherPercent:
-	case FUNC_ID::kIsContinuingPackagePCNear:
-	case FUNC_ID::kCanHaveFlames:
-	case FUNC_ID::kHasFlames:
-	case FUNC_ID::kGetOpenState:
-	case FUNC_ID::kGetSitting:
-	case FUNC_ID::kGetDayOfWeek:
-	case FUNC_ID::kIsPCSleeping:
-	case FUNC_ID::kIsPCAMurderer:
-	case FUNC_ID::kIsSwimming:
-	case FUNC_ID::kGetAmountSoldStolen:
-	case FUNC_ID::kGetIgnoreCrime:
-	case FUNC_ID::kGetDestroyed:
-	case FUNC_ID::kGetDefaultOpen:
-	case FUNC_ID::kGetAnimAction:
-	case FUNC_ID::kGetVATSMode:
-	case FUNC_ID::kGetPersuasionNumber:
-	case FUNC_ID::kGetVampireFeed:
-	case FUNC_ID::kGetCannibal:
-	case FUNC_ID::kGetClassDefaultMatch:
-	case FUNC_ID::kGetVatsTargetHeight:
-	case FUNC_ID::kGetIsGhost:
-	case FUNC_ID::kGetUnconscious:
-	case FUNC_ID::kGetRestrained:
-	case FUNC_ID::kIsInDialogueWithPlayer:
-	case FUNC_ID::kGetIsPlayableRace:
-	case FUNC_ID::kGetOffersServicesNow:
-	case FUNC_ID::kIsWeaponOut:
-	case FUNC_ID::kIsTimePassing:
-	case FUNC_ID::kIsPleasant:
-	case FUNC_ID::kIsCloudy:
-	case FUNC_ID::kIsSmallBump:
-	case FUNC_ID::kIsHorseStolen:
-	case FUNC_ID::kIsLeftUp:
-	case FUNC_ID::kIsSneaking:
-	case FUNC_ID::kIsRunning:
-	case FUNC_ID::kGetFriendHit:
-	case FUNC_ID::kIsInInterior:
-	case FUNC_ID::kIsWaterObject:
-	case FUNC_ID::kGetPlayerAction:
-	case FUNC_ID::kIsActorUsingATorch:
-	case FUNC_ID::kIsXBox:
-	case FUNC_ID::kGetPairedAnimation:
-	case FUNC_ID::kIsActorAVictim:
-	case FUNC_ID::kGetTotalPersuasionNumber:
-	case FUNC_ID::kGetIdleDoneOnce:
-	case FUNC_ID::kGetNoRumors:
-	case FUNC_ID::kGetCombatState:
-	case FUNC_ID::kIsRidingMount:
-	case FUNC_ID::kIsFleeing:
-	case FUNC_ID::kIsInDangerousWater:
-	case FUNC_ID::kGetIgnoreFriendlyHits:
-	case FUNC_ID::kIsPlayersLastRiddenMount:
-	case FUNC_ID::kIsActor:
-	case FUNC_ID::kIsEssential:
-	case FUNC_ID::kIsPlayerMovingIntoNewSpace:
-	case FUNC_ID::kGetTimeDead:
-	case FUNC_ID::kIsChild:
-	case FUNC_ID::kGetLastPlayerAction:
-	case FUNC_ID::kGetCrimeGoldViolent:
-	case FUNC_ID::kGetCrimeGoldNonviolent:
-	case FUNC_ID::kGetHitLocation:
-	case FUNC_ID::kIsPC1stPerson:
-	case FUNC_ID::kGetCauseofDeath:
-	case FUNC_ID::kIsBribedbyPlayer:
-	case FUNC_ID::kGetGroupMemberCount:
-	case FUNC_ID::kGetGroupTargetCount:
-	case FUNC_ID::kGetPlantedExplosive:
-	case FUNC_ID::kIsScenePackageRunning:
-	case FUNC_ID::kGetHealthPercentage:
-	case FUNC_ID::kGetDialogueEmotion:
-	case FUNC_ID::kGetDialogueEmotionValue:
-	case FUNC_ID::kGetPlayerTeammate:
-	case FUNC_ID::kGetPlayerTeammateCount:
-	case FUNC_ID::kGetActorCrimePlayerEnemy:
-	case FUNC_ID::kGetCrimeGold:
-	case FUNC_ID::kGetDestructionStage:
-	case FUNC_ID::kIsProtected:
-	case FUNC_ID::kIsCarryable:
-	case FUNC_ID::kGetConcussed:
-	case FUNC_ID::kGetMapMarkerVisible:
-	case FUNC_ID::kGetKillingBlowLimb:
-	case FUNC_ID::kCanPayCrimeGold:
-	case FUNC_ID::kGetDaysInJail:
-	case FUNC_ID::kEPAlchemyGetMakingPoison:
-	case FUNC_ID::kGetAllowWorldInteractions:
-	case FUNC_ID::kGetLastHitCritical:
-	case FUNC_ID::kGetIsLockBroken:
-	case FUNC_ID::kIsPS3:
-	case FUNC_ID::kIsWin32:
-	case FUNC_ID::kGetXPForNextLevel:
-	case FUNC_ID::kGetInfamy:
-	case FUNC_ID::kGetInfamyViolent:
-	case FUNC_ID::kGetInfamyNonViolent:
-	case FUNC_ID::kIsGoreDisabled:
-	case FUNC_ID::kGetActorsInHigh:
-	case FUNC_ID::kHasLoaded3D:
-	case FUNC_ID::kIsSprinting:
-	case FUNC_ID::kIsBlocking:
-	case FUNC_ID::kGetAttackState:
-	case FUNC_ID::kIsBleedingOut:
-	case FUNC_ID::kGetMovementDirection:
-	case FUNC_ID::kIsInScene:
-	case FUNC_ID::kGetIsFlying:
-	case FUNC_ID::kGetHighestRelationshipRank:
-	case FUNC_ID::kGetLowestRelationshipRank:
-	case FUNC_ID::kHasFamilyRelationshipAny:
-	case FUNC_ID::kGetPathingTargetSpeed:
-	case FUNC_ID::kGetMovementSpeed:
-	case FUNC_ID::kIsDualCasting:
-	case FUNC_ID::kIsEnteringInteractionQuick:
-	case FUNC_ID::kIsCasting:
-	case FUNC_ID::kGetFlyingState:
-	case FUNC_ID::kIsInFavorState:
-	case FUNC_ID::kHasTwoHandedWeaponEquipped:
-	case FUNC_ID::kIsExitingInstant:
-	case FUNC_ID::kIsInFriendStateWithPlayer:
-	case FUNC_ID::kIsUnique:
-	case FUNC_ID::kGetLastBumpDirection:
-	case FUNC_ID::kGetIsInjured:
-	case FUNC_ID::kGetIsCrashLandRequest:
-	case FUNC_ID::kGetIsHastyLandRequest:
-	case FUNC_ID::kGetBribeSuccess:
-	case FUNC_ID::kGetIntimidateSuccess:
-	case FUNC_ID::kGetArrestedState:
-	case FUNC_ID::kGetArrestingActor:
-	case FUNC_ID::kEPTemperingItemIsEnchanted:
-	case FUNC_ID::kIsAttacking:
-	case FUNC_ID::kIsPowerAttacking:
-	case FUNC_ID::kIsLastHostileActor:
-	case FUNC_ID::kGetCurrentShoutVariation:
-	case FUNC_ID::kGetActivationHeight:
-	case FUNC_ID::kGetPathingCurrentSpeed:
-	case FUNC_ID::kGetNoBleedoutRecovery:
-	case FUNC_ID::kIsAllowedToFly:
-	case FUNC_ID::kIsCommandedActor:
-	case FUNC_ID::kIsStaggered:
-	case FUNC_ID::kIsRecoiling:
-	case FUNC_ID::kIsExitingInteractionQuick:
-	case FUNC_ID::kIsPathing:
-	case FUNC_ID::kGetCombatGroupMemberCount:
-	case FUNC_ID::kIsIgnoringCombat:
-	case FUNC_ID::kGetLightLevel:
-	case FUNC_ID::kIsBeingRidden:
-	case FUNC_ID::kIsUndead:
-	case FUNC_ID::kGetRealHoursPassed:
-	case FUNC_ID::kIsUnlockedDoor:
-	case FUNC_ID::kIsPoison:
-	case FUNC_ID::kGetItemHealthPercent:
-	case FUNC_ID::kEffectWasDualCast:
-	case FUNC_ID::kGetKnockStateEnum:
-	case FUNC_ID::kDoesNotExist:
-	case FUNC_ID::kIsOnFlyingMount:
-	case FUNC_ID::kCanFlyHere:
-	case FUNC_ID::kIsFlyingMountPatrolQueued:
-	case FUNC_ID::kIsFlyingMountFastTravelling:
-	case FUNC_ID::kIsOverEncumbered:
-	case FUNC_ID::kGetActorWarmth:
-		paramPair = { std::nullopt, std::nullopt };
-		break;
-	case FUNC_ID::kGetDistance:
-	case FUNC_ID::kGetLineOfSight:
-	case FUNC_ID::kGetInSameCell:
-	case FUNC_ID::kGetHeadingAngle:
-	case FUNC_ID::kGetIsReference:
-	case FUNC_ID::kIsCurrentFurnitureRef:
-	case FUNC_ID::kGetRelationshipRank:
-	case FUNC_ID::kExists:
-	case FUNC_ID::kIsPlayerGrabbedRef:
-	case FUNC_ID::kGetVATSRightAreaFree:
-	case FUNC_ID::kGetVATSLeftAreaFree:
-	case FUNC_ID::kGetVATSBackAreaFree:
-	case FUNC_ID::kGetVATSFrontAreaFree:
-	case FUNC_ID::kGetVATSRightTargetVisible:
-	case FUNC_ID::kGetVATSLeftTargetVisible:
-	case FUNC_ID::kGetVATSBackTargetVisible:
-	case FUNC_ID::kGetVATSFrontTargetVisible:
-	case FUNC_ID::kGetInContainer:
-	case FUNC_ID::kGetInSharedCrimeFaction:
-	case FUNC_ID::kGetTargetHeight:
-		paramPair = { PARAM_TYPE::kObjectRef, std::nullopt };
-		break;
-	case FUNC_ID::kGetPos:
-	case FUNC_ID::kGetAngle:
-	case FUNC_ID::kGetStartingPos:
-	case FUNC_ID::kGetStartingAngle:
-	case FUNC_ID::kGetVelocity:
-	case FUNC_ID::kGetPathingTargetOffset:
-	case FUNC_ID::kGetPathingTargetAngleOffset:
-	case FUNC_ID::kGetPathingTargetSpeedAngle:
-	case FUNC_ID::kGetPathingCurrentSpeedAngle:
-		paramPair = { PARAM_TYPE::kAxis, std::nullopt };
-		break;
-	case FUNC_ID::kGetActorValue:
-	case FUNC_ID::kIsWeaponSkillType:
-	case FUNC_ID::kGetBaseActorValue:
-	case FUNC_ID::kGetPermanentActorValue:
-	case FUNC_ID::kGetActorValuePercent:
-	case FUNC_ID::kEPModSkillUsage_IsAdvanceSkill:
-	case FUNC_ID::kEPMagic_SpellHasSkill:
-		paramPair = { PARAM_TYPE::kActorValue, std::nullopt };
-		break;
-	case FUNC_ID::kMenuMode:
-	case FUNC_ID::kIsInCombat:
-	case FUNC_ID::kIsPlayerActionActive:
-	case FUNC_ID::kGetHasNote:
-	case FUNC_ID::kIsLimbGone:
-	case FUNC_ID::kGetIsCreatureType:
-	case FUNC_ID::kGetNumericPackageData:
-		paramPair = { PARAM_TYPE::kInt, std::nullopt };
-		break;
-	case FUNC_ID::kSameFaction:
-	case FUNC_ID::kSameRace:
-	case FUNC_ID::kSameSex:
-	case FUNC_ID::kGetDetected:
-	case FUNC_ID::kGetShouldAttack:
-	case FUNC_ID::kGetTalkedToPCParam:
-	case FUNC_ID::kHasFamilyRelationship:
-	case FUNC_ID::kHasParentRelationship:
-	case FUNC_ID::kIsTalkingActivatorActor:
-	case FUNC_ID::kIsKiller:
-	case FUNC_ID::kGetFactionRelation:
-	case FUNC_ID::kGetThreatRatio:
-	case FUNC_ID::kIsCombatTarget:
-	case FUNC_ID::kShouldAttackKill:
-	case FUNC_ID::kGetShouldHelp:
-	case FUNC_ID::kIsHostileToActor:
-		paramPair = { PARAM_TYPE::kActor, std::nullopt };
-		break;
-	case FUNC_ID::kGetItemCount:
-	case FUNC_ID::kGetEquipped:
-		paramPair = { PARAM_TYPE::kInvObjectOrFormList, std::nullopt };
-		break;
-	case FUNC_ID::kGetScriptVariable:
-	case FUNC_ID::kGetVMScriptVariable:
-		paramPair = { PARAM_TYPE::kObjectRef, PARAM_TYPE::kChar };
-		break;
-	case FUNC_ID::kGetQuestRunning:
-	case FUNC_ID::kGetStage:
-	case FUNC_ID::kGetQuestCompleted:
-		paramPair = { PARAM_TYPE::kQuest, std::nullopt };
-		break;
-	case FUNC_ID::kGetStageDone:
-		paramPair = { PARAM_TYPE::kQuest, PARAM_TYPE::kInt };
-		break;
-	case FUNC_ID::kGetFactionRankDifference:
-		paramPair = { PARAM_TYPE::kFaction, PARAM_TYPE::kActor };
-		break;
-	case FUNC_ID::kGetInCell:
-		paramPair = { PARAM_TYPE::kCell, std::nullopt };
-		break;
-	case FUNC_ID::kGetIsClass:
-	case FUNC_ID::kGetPCIsClass:
-	case FUNC_ID::kGetIsClassDefault:
-		paramPair = { PARAM_TYPE::kClass, std::nullopt };
-		break;
-	case FUNC_ID::kGetIsRace:
-	case FUNC_ID::kGetPCIsRace:
-		paramPair = { PARAM_TYPE::kRace, std::nullopt };
-		break;
-	case FUNC_ID::kGetIsSex:
-	case FUNC_ID::kGetPCIsSex:
-		paramPair = { PARAM_TYPE::kSex, std::nullopt };
-		break;
-	case FUNC_ID::kGetInFaction:
-	case FUNC_ID::kGetFactionRank:
-	case FUNC_ID::kGetPCInFaction:
-	case FUNC_ID::kGetIsCrimeFaction:
-	case FUNC_ID::kGetPCExpelled:
-	case FUNC_ID::kGetPCFactionMurder:
-	case FUNC_ID::kGetPCEnemyofFaction:
-	case FUNC_ID::kGetPCFactionAttack:
-	case FUNC_ID::kGetStolenItemValueNoCrime:
-	case FUNC_ID::kGetStolenItemValue:
-		paramPair = { PARAM_TYPE::kFaction, std::nullopt };
-		break;
-	case FUNC_ID::kGetIsID:
-	case FUNC_ID::kGetIsUsedItem:
-		paramPair = { PARAM_TYPE::kObjectOrFormList, std::nullopt };
-		break;
-	case FUNC_ID::kGetGlobalValue:
-		paramPair = { PARAM_TYPE::kGlobal, std::nullopt };
-		break;
-	case FUNC_ID::kGetQuestVariable:
-	case FUNC_ID::kGetVMQuestVariable:
-		paramPair = { PARAM_TYPE::kQuest, PARAM_TYPE::kChar };
-		break;
-	case FUNC_ID::kGetDeadCount:
-		paramPair = { PARAM_TYPE::kActorBase, std::nullopt };
-		break;
-	case FUNC_ID::kGetPlayerControlsDisabled:
-		paramPair = { PARAM_TYPE::kInt, PARAM_TYPE::kInt };
-		break;
-	case FUNC_ID::kIsPlayerInRegion:
-		paramPair = { PARAM_TYPE::kRegion, std::nullopt };
-		break;
-	case FUNC_ID::kGetCrime:
-		paramPair = { PARAM_TYPE::kActor, PARAM_TYPE::kCrimeType };
-		break;
-	case FUNC_ID::kGetIsCurrentWeather:
-		paramPair = { PARAM_TYPE::kWeather, std::nullopt };
-		break;
-	case FUNC_ID::kGetIsCurrentPackage:
-		paramPair = { PARAM_TYPE::kPackage, std::nullopt };
-		break;
-	case FUNC_ID::kIsCurrentFurnitureObj:
-		paramPair = { PARAM_TYPE::kFurnitureOrFormList, std::nullopt };
-		break;
-	case FUNC_ID::kHasSameEditorLocAsRef:
-	case FUNC_ID::kIsInSameCurrentLocAsRef:
-	case FUNC_ID::kIsLinkedTo:
-		paramPair = { PARAM_TYPE::kObjectRef, PARAM_TYPE::kKeyword };
-		break;
-	case FUNC_ID::kHasSameEditorLocAsRefAlias:
-	case FUNC_ID::kIsInSameCurrentLocAsRefAlias:
-	case FUNC_ID::kGetKeywordDataForAlias:
-	case FUNC_ID::kLocAliasHasKeyword:
-		paramPair = { PARAM_TYPE::kAlias, PARAM_TYPE::kKeyword };
-		break;
-	case FUNC_ID::kHasMagicEffect:
-		paramPair = { PARAM_TYPE::kMagicEffect, std::nullopt };
-		break;
-	case FUNC_ID::kIsSpellTarget:
-	case FUNC_ID::kHasSpell:
-	case FUNC_ID::kGetSpellUsageNum:
-		paramPair = { PARAM_TYPE::kMagicItem, std::nullopt };
-		break;
-	case FUNC_ID::kGetInCellParam:
-		paramPair = { PARAM_TYPE::kCell, PARAM_TYPE::kObjectRef };
-		break;
-	case FUNC_ID::kGetIsUsedItemType:
-	case FUNC_ID::kGetIsObjectType:
-		paramPair = { PARAM_TYPE::kFormType, std::nullopt };
-		break;
-	case FUNC_ID::kIsScenePlaying:
-		paramPair = { PARAM_TYPE::kBGSScene, std::nullopt };
-		break;
-	case FUNC_ID::kGetLocationCleared:
-	case FUNC_ID::kGetInCurrentLoc:
-	case FUNC_ID::kGetIsEditorLocation:
-	case FUNC_ID::kIsLocationLoaded:
-		paramPair = { PARAM_TYPE::kLocation, std::nullopt };
-		break;
-	case FUNC_ID::kHasAssociationType:
-		paramPair = { PARAM_TYPE::kActor, PARAM_TYPE::kAssociationType };
-		break;
-	case FUNC_ID::kIsWarningAbout:
-	case FUNC_ID::kIsInList:
-	case FUNC_ID::kIsWeaponInList:
-	case FUNC_ID::kIsKillerObject:
-	case FUNC_ID::kGetInCurrentLocFormList:
-		paramPair = { PARAM_TYPE::kFormList, std::nullopt };
-		break;
-	case FUNC_ID::kIsOwner:
-		paramPair = { PARAM_TYPE::kOwner, std::nullopt };
-		break;
-	case FUNC_ID::kIsCellOwner:
-		paramPair = { PARAM_TYPE::kCell, PARAM_TYPE::kOwner };
-		break;
-	case FUNC_ID::kGetInWorldspace:
-		paramPair = { PARAM_TYPE::kWorldOrList, std::nullopt };
-		break;
-	case FUNC_ID::kGetPCMiscStat:
-		paramPair = { PARAM_TYPE::kMiscStat, std::nullopt };
-		break;
-	case FUNC_ID::kGetWithinPackageLocation:
-	case FUNC_ID::kIsNullPackageData:
-		paramPair = { PARAM_TYPE::kPackageDataCanBeNull, std::nullopt };
-		break;
-	case FUNC_ID::kGetInCurrentLocAlias:
-	case FUNC_ID::kGetIsAliasRef:
-	case FUNC_ID::kGetIsEditorLocAlias:
-	case FUNC_ID::kGetLocationAliasCleared:
-	case FUNC_ID::kIsLocAliasLoaded:
-		paramPair = { PARAM_TYPE::kAlias, std::nullopt };
-		break;
-	case FUNC_ID::kHasLinkedRef:
-	case FUNC_ID::kGetKeywordItemCount:
-	case FUNC_ID::kEPAlchemyEffectHasKeyword:
-	case FUNC_ID::kHasKeyword:
-	case FUNC_ID::kLocationHasKeyword:
-	case FUNC_ID::kGetKeywordDataForCurrentLocation:
-	case FUNC_ID::kEPTemperingItemHasKeyword:
-	case FUNC_ID::kWornHasKeyword:
-	case FUNC_ID::kEPModSkillUsage_AdvanceObjectHasKeyword:
-	case FUNC_ID::kEPMagic_SpellHasKeyword:
-	case FUNC_ID::kIsAttackType:
-	case FUNC_ID::kHasMagicEffectKeyword:
-	case FUNC_ID::kGetCombatTargetHasKeyword:
-	case FUNC_ID::kWornApparelHasKeywordCount:
-		paramPair = { PARAM_TYPE::kKeyword, std::nullopt };
-		break;
-	case FUNC_ID::kHasShout:
-	case FUNC_ID::kGetEquippedShout:
-		paramPair = { PARAM_TYPE::kShout, std::nullopt };
-		break;
-	case FUNC_ID::kGetVATSValue:
-		paramPair = { PARAM_TYPE::kInt, PARAM_TYPE::kInt };
-		break;
-	case FUNC_ID::kGetFactionCombatReaction:
-		paramPair = { PARAM_TYPE::kFaction, PARAM_TYPE::kFaction };
-		break;
-	case FUNC_ID::kGetIsVoiceType:
-		paramPair = { PARAM_TYPE::kVoiceType, std::nullopt };
-		break;
-	case FUNC_ID::kGetInZone:
-		paramPair = { PARAM_TYPE::kEncounterZone, std::nullopt };
-		break;
-	case FUNC_ID::kGetGraphVariableFloat:
-	case FUNC_ID::kGetGraphVariableInt:
-		paramPair = { PARAM_TYPE::kChar, std::nullopt };
-		break;
-	case FUNC_ID::kHasPerk:
-		paramPair = { PARAM_TYPE::kPerk, PARAM_TYPE::kInt };
-		break;
-	case FUNC_ID::kIsLastIdlePlayed:
-		paramPair = { PARAM_TYPE::kIdleForm, std::nullopt };
-		break;
-	case FUNC_ID::kGetIsAlignment:
-		paramPair = { PARAM_TYPE::kAlignment, std::nullopt };
-		break;
-	case FUNC_ID::kGetIsUsedItemEquipType:
-		paramPair = { PARAM_TYPE::kEquipType, std::nullopt };
-		break;
-	case FUNC_ID::kPlayerKnows:
-		paramPair = { PARAM_TYPE::kKnowableForm, std::nullopt };
-		break;
-	case FUNC_ID::kIsInCriticalStage:
-		paramPair = { PARAM_TYPE::kCritStage, std::nullopt };
-		break;
-	case FUNC_ID::kIsSceneActionComplete:
-		paramPair = { PARAM_TYPE::kBGSScene, PARAM_TYPE::kInt };
-		break;
-	case FUNC_ID::kHasRefType:
-	case FUNC_ID::kLocationHasRefType:
-		paramPair = { PARAM_TYPE::kRefType, std::nullopt };
-		break;
-	case FUNC_ID::kHasEquippedSpell:
-	case FUNC_ID::kGetCurrentCastingType:
-	case FUNC_ID::kGetCurrentDeliveryType:
-	case FUNC_ID::kGetEquippedItemType:
-	case FUNC_ID::kGetReplacedItemType:
-	case FUNC_ID::kHasBoundWeaponEquipped:
-		paramPair = { PARAM_TYPE::kCastingSource, std::nullopt };
-		break;
-	case FUNC_ID::kGetEventData:
-		paramPair = { PARAM_TYPE::kEventFunction, PARAM_TYPE::kEventFunctionData };  // third parameter in xEdit but who cares, we're skipping this
-		break;
-	case FUNC_ID::kIsCloserToAThanB:
-		paramPair = { PARAM_TYPE::kObjectRef, PARAM_TYPE::kObjectRef };
-		break;
-	case FUNC_ID::kGetRelativeAngle:
-		paramPair = { PARAM_TYPE::kObjectRef, PARAM_TYPE::kAxis };
-		break;
-	case FUNC_ID::kGetRefTypeDeadCount:
-	case FUNC_ID::kGetRefTypeAliveCount:
-		paramPair = { PARAM_TYPE::kLocation, PARAM_TYPE::kRefType };
-		break;
-	case FUNC_ID::kIsCurrentSpell:
-		paramPair = { PARAM_TYPE::kMagicItem, PARAM_TYPE::kCastingSource };
-		break;
-	case FUNC_ID::kSpellHasKeyword:
-		paramPair = { PARAM_TYPE::kCastingSource, PARAM_TYPE::kKeyword };
-		break;
-	case FUNC_ID::kGetLocAliasRefTypeDeadCount:
-	case FUNC_ID::kGetLocAliasRefTypeAliveCount:
-		paramPair = { PARAM_TYPE::kAlias, PARAM_TYPE::kRefType };
-		break;
-	case FUNC_ID::kIsWardState:
-		paramPair = { PARAM_TYPE::kWardState, std::nullopt };
-		break;
-	case FUNC_ID::kLocAliasIsLocation:
-		paramPair = { PARAM_TYPE::kAlias, PARAM_TYPE::kLocation };
-		break;
-	case FUNC_ID::kGetKeywordDataForLocation:
-		paramPair = { PARAM_TYPE::kLocation, PARAM_TYPE::kKeyword };
-		break;
-	case FUNC_ID::kIsFurnitureAnimType:
-	case FUNC_ID::kIsInFurnitureState:
-		paramPair = { PARAM_TYPE::kFurnitureAnimType, std::nullopt };
-		break;
-	case FUNC_ID::kIsFurnitureEntryType:
-		paramPair = { PARAM_TYPE::kFurnitureEntryType, std::nullopt };
-		break;
-	case FUNC_ID::kHasAssociationTypeAny:
-		paramPair = { PARAM_TYPE::kAssociationType, std::nullopt };
-		break;
-	case FUNC_ID::kGetWithinDistance:
-		paramPair = { PARAM_TYPE::kObjectRef, PARAM_TYPE::kFloat };
-		break;
-	case FUNC_ID::kEPModSkillUsage_IsAdvanceAction:
-		paramPair = { PARAM_TYPE::kSkillAction, std::nullopt };
-		break;
-	case FUNC_ID::kSpellHasCastingPerk:
-		paramPair = { PARAM_TYPE::kPerk, std::nullopt };
-		break;
-	default:
-		paramPair = { std::nullopt, std::nullopt };
-		break;
+namespace
+{
+	template <class T>
+	T to_num(std::string_view a_str)
+	{
+		T val{};
+		std::from_chars(a_str.data(), a_str.data() + a_str.size(), val);
+		return val;
 	}
+}
 
-	return paramPair;
+PARAMS ConditionParser::GetFuncType(FUNC_ID a_funcID)
+{
+	return ConditionFunctions::GetParamTypes(a_funcID);
 }
 
-bool ConditionParser::ParseVoidParam(const std::string& a_str, VOID_PARAM& a_param, PARAM_TYPE a_type)
+bool ConditionParser::ParseVoidParam(std::string_view a_str, VOID_PARAM& a_param, PARAM_TYPE a_type)
 {
 	switch (a_type) {
 	case PARAM_TYPE::kInt:
 	case PARAM_TYPE::kStage:
 	case PARAM_TYPE::kRelationshipRank:
-		a_param.i = string::to_num<std::int32_t>(a_str);
+		a_param.i = to_num<std::int32_t>(a_str);
 		break;
 	case PARAM_TYPE::kFloat:
-		a_param.f = string::to_num<float>(a_str);
+		a_param.f = to_num<float>(a_str);
 		break;
 	case PARAM_TYPE::kActorValue:
-		a_param.i = static_cast<std::int32_t>(RE::ActorValueList::LookupActorValueByName(a_str.c_str()));
+		a_param.i = static_cast<std::int32_t>(RE::ActorValueList::LookupActorValueByName(std::string(a_str).c_str()));
 		break;
 	case RE::SCRIPT_PARAM_TYPE::kAxis:
 		{
@@ -696,25 +157,15 @@ bool ConditionParser::ParseVoidParam(const std::string& a_str, VOID_PARAM& a_par
 	case PARAM_TYPE::kImagespaceMod:
 	case PARAM_TYPE::kImagespace:
 		{
-			if (a_str == "PlayerRef") {
+			if (a_str == "PlayerRef"sv) {
 				a_param.ptr = RE::PlayerCharacter::GetSingleton();
 			} else {
-				a_param.ptr = RE::GetForm(a_str);
+				a_param.ptr = RE::GetForm(std::string(a_str));
 			}
 		}
 		break;
 	case PARAM_TYPE::kKeyword:
-		{
-			if (dist::get_record_type(a_str) == dist::kEditorID) {
-				const auto& keywordArray = RE::TESDataHandler::GetSingleton()->GetFormArray<RE::BGSKeyword>();
-				const auto  it = std::ranges::find_if(keywordArray, [&](const auto& keyword) { return keyword->formEditorID == a_str.c_str(); });
-				if (it != keywordArray.end()) {
-					a_param.ptr = *it;
-				}
-			} else {
-				a_param.ptr = RE::GetForm(a_str);
-			}
-		}
+		a_param.ptr = RE::GetKeyword(a_str);
 		break;
 	default:
 		return false;
@@ -723,42 +174,209 @@ bool ConditionParser::ParseVoidParam(const std::string& a_str, VOID_PARAM& a_par
 	return true;
 }
 
-std::unique_ptr<RE::TESCondition> ConditionParser::BuildCondition(const std::vector<std::string>& a_conditionList)
+std::optional<ConditionParser::Tokens> ConditionParser::Tokenize(std::string_view a_condition, TokenError& a_error)
+{
+	ConditionGrammar::Error error;
+	const auto              match = ConditionGrammar::Split(a_condition, error);
+	if (!match) {
+		a_error = { error.pos, error.reason };
+		return std::nullopt;
+	}
+
+	Tokens tokens{
+		.subject = match->subject,
+		.function = match->function,
+		.param1 = match->param1,
+		.param2 = match->param2,
+		.isOR = match->andOr == "OR"sv
+	};
+
+	// opcode
+	switch (string::const_hash(match->opCode)) {
+	case "=="_h:
+		tokens.opCode = OP_CODE::kEqualTo;
+		break;
+	case "!="_h:
+		tokens.opCode = OP_CODE::kNotEqualTo;
+		break;
+	case ">"_h:
+		tokens.opCode = OP_CODE::kGreaterThan;
+		break;
+	case ">="_h:
+		tokens.opCode = OP_CODE::kGreaterThanOrEqualTo;
+		break;
+	case "<"_h:
+		tokens.opCode = OP_CODE::kLessThan;
+		break;
+	case "<="_h:
+		tokens.opCode = OP_CODE::kLessThanOrEqualTo;
+		break;
+	default:
+		a_error = { static_cast<std::size_t>(match->opCode.data() - a_condition.data()), "unknown comparison operator"sv };
+		return std::nullopt;
+	}
+
+	// value, the leading number like the old string to float conversion
+	tokens.value = to_num<float>(match->value);
+
+	return tokens;
+}
+
+std::string ConditionParser::Normalize(const std::vector<std::string>& a_conditionList)
+{
+	std::string result;
+	for (const auto& condition : a_conditionList) {
+		// runs collapse to one space but are kept at either end, where whitespace changes how a line splits
+		ConditionGrammar::Cursor cursor{ condition };
+		while (!cursor.at_end()) {
+			result += cursor.take_while([](char a_ch) { return !std::isspace(static_cast<unsigned char>(a_ch)); });
+			if (!cursor.at_end()) {
+				cursor.skip_ws();
+				result += ' ';
+			}
+		}
+		result += '\n';
+	}
+	return result;
+}
+
+bool ConditionParser::IsFormParam(PARAM_TYPE a_type)
+{
+	switch (a_type) {
+	case PARAM_TYPE::kInt:
+	case PARAM_TYPE::kStage:
+	case PARAM_TYPE::kRelationshipRank:
+	case PARAM_TYPE::kFloat:
+	case PARAM_TYPE::kAxis:
+	case PARAM_TYPE::kSex:
+	case PARAM_TYPE::kFormType:
+	case PARAM_TYPE::kCastingSource:
+	case PARAM_TYPE::kWardState:
+		return false;
+	default:
+		return true;
+	}
+}
+
+std::shared_ptr<const ConditionParser::Compiled> ConditionParser::Compile(const std::vector<std::string>& a_conditionList)
 {
-	static srell::regex condRegex{ R"((\w+)?\s*(\w+)\s+(\w+)(?:\s+(\w+))?\s*([=!<>]+)\s*([\d.]+)\s*(AND|OR)?)" };
+	if (a_conditionList.empty()) {
+		return nullptr;
+	}
+
+	auto key = Normalize(a_conditionList);
+	{
+		std::scoped_lock lock(compiledLock);
+		if (const auto it = compiledConditions.find(key); it != compiledConditions.end()) {
+			return it->second;
+		}
+	}
 
-	auto conditionPtr = std::make_unique<RE::TESCondition>();
-	bool addedCondition = false;
+	auto compiled = std::make_shared<Compiled>();
+	compiled->key = key;
 
 	for (auto& condition : a_conditionList) {
-		srell::cmatch match;
-		if (!srell::regex_match(condition.c_str(), match, condRegex)) {
+		TokenError error;
+		const auto tokens = Tokenize(condition, error);
+		if (!tokens) {
+			Log::config->warn("\t\tCondition \"{}\" : {} at column {}", condition, error.reason, error.pos + 1);
+			continue;
+		}
+
+		Compiled::Item item{
+			.opCode = tokens->opCode,
+			.value = tokens->value,
+			.isOR = tokens->isOR
+		};
+		// subject
+		if (const auto& subject = tokens->subject; subject.empty()) {
+			// runs on the subject passed to IsTrue
+		} else if (subject == "Self"sv) {
+			item.object = RE::CONDITIONITEMOBJECT::kSelf;
+		} else if (subject == "Target"sv) {
+			item.object = RE::CONDITIONITEMOBJECT::kTarget;
+		} else if (subject == "CombatTarget"sv) {
+			item.object = RE::CONDITIONITEMOBJECT::kCombatTarget;
+		} else {
+			item.subject = subject;
+		}
+		// funcID
+		if (const auto funcID = ConditionFunctions::ids.find(tokens->function)) {
+			item.function = static_cast<FUNC_ID>(*funcID);
+		} else {
+			Log::config->warn("\t\tCondition \"{}\" : unknown function {} at column {}", condition, tokens->function, tokens->function.data() - condition.data() + 1);
+			continue;
+		}
+		// params, literals are parsed now and forms once they're loaded
+		const auto [param1Type, param2Type] = GetFuncType(item.function);
+		const auto compileParam = [](std::optional<Compiled::Param>& a_param, const std::optional<PARAM_TYPE>& a_type, std::string_view a_str) {
+			if (!a_type || a_str.empty()) {
+				return true;
+			}
+			a_param.emplace(Compiled::Param{ .type = *a_type });
+			if (IsFormParam(*a_type)) {
+				a_param->text = a_str;
+				return true;
+			}
+			return ParseVoidParam(a_str, a_param->value, *a_type);
+		};
+		if (!compileParam(item.params[0], param1Type, tokens->param1) || !compileParam(item.params[1], param2Type, tokens->param2)) {
 			continue;
 		}
 
-		auto& subject = match[1];
-		auto& functionID = match[2];
-		auto& param1 = match[3];
-		auto& param2 = match[4];
-		auto& opCode = match[5];
-		auto& value = match[6];
-		auto& andOR = match[7];
+		compiled->items.push_back(std::move(item));
+	}
 
+	std::scoped_lock lock(compiledLock);
+	return compiledConditions.try_emplace(std::move(key), std::move(compiled)).first->second;
+}
+
+void ConditionParser::ClearCompiled()
+{
+	std::scoped_lock lock(compiledLock);
+	compiledConditions.clear();
+}
+
+std::shared_ptr<const RE::TESCondition> ConditionParser::BuildCondition(const std::vector<std::string>& a_conditionList)
+{
+	const auto compiled = Compile(a_conditionList);
+	return compiled ? BuildCondition(*compiled) : nullptr;
+}
+
+std::shared_ptr<const RE::TESCondition> ConditionParser::BuildCondition(const Compiled& a_compiled)
+{
+	if (a_compiled.items.empty()) {
+		return nullptr;
+	}
+
+	if (const auto it = internedConditions.find(a_compiled.key); it != internedConditions.end()) {
+		if (auto condition = it->second.lock()) {
+			return condition;
+		}
+	}
+
+	std::shared_ptr<const RE::TESCondition> condition = Resolve(a_compiled);
+	if (condition) {
+		internedConditions.insert_or_assign(a_compiled.key, condition);
+	}
+	return condition;
+}
+
+std::unique_ptr<RE::TESCondition> ConditionParser::Resolve(const Compiled& a_compiled)
+{
+	auto  conditionPtr = std::make_unique<RE::TESCondition>();
+	auto* tail = &conditionPtr->head;
+
+	for (const auto& item : a_compiled.items) {
 		RE::CONDITION_ITEM_DATA condData{};
 		// subject
-		auto subjectStr = subject.str();
-		if (subjectStr == "Self") {
-			condData.object = RE::CONDITIONITEMOBJECT::kSelf;
-		} else if (subjectStr == "Target") {
-			condData.object = RE::CONDITIONITEMOBJECT::kTarget;
-		} else if (subjectStr == "CombatTarget") {
-			condData.object = RE::CONDITIONITEMOBJECT::kCombatTarget;
-		} else {
+		condData.object = item.object;
+		if (!item.subject.empty()) {
 			RE::TESForm* refForm{};
-			if (subjectStr == "PlayerRef") {
+			if (item.subject == "PlayerRef"sv) {
 				refForm = RE::PlayerCharacter::GetSingleton();
 			} else {
-				refForm = RE::GetForm(subjectStr);
+				refForm = RE::GetForm(item.subject);
 			}
 			if (auto ref = refForm ? refForm->AsReference() : nullptr) {
 				condData.runOnRef = ref->CreateRefHandle();
@@ -766,74 +384,145 @@ std::unique_ptr<RE::TESCondition> ConditionParser::BuildCondition(const std::vec
 			}
 		}
 		// funcID
-		if (auto it = funcIDs.find(functionID.str()); it != funcIDs.end()) {
-			condData.functionData.function = static_cast<FUNC_ID>(it->second);
-		} else {
-			continue;
-		}
-		auto [param1Type, param2Type] = GetFuncType(*condData.functionData.function);
-		// param1
-		if (param1Type && param1.matched) {
-			VOID_PARAM param{};
-			if (ParseVoidParam(param1.str(), param, *param1Type)) {
-				condData.functionData.params[0] = std::bit_cast<void*>(param);
-			} else {
-				continue;
-			}
-		}
-		// param2
-		if (param2Type && param2.matched) {
-			VOID_PARAM param{};
-			if (ParseVoidParam(param2.str(), param, *param2Type)) {
-				condData.functionData.params[1] = std::bit_cast<void*>(param);
-			} else {
-				continue;
+		condData.functionData.function = item.function;
+		// params
+		bool resolved = true;
+		for (std::size_t i = 0; i < item.params.size(); ++i) {
+			if (const auto& param = item.params[i]) {
+				VOID_PARAM value = param->value;
+				if (!param->text.empty() && !ParseVoidParam(param->text, value, param->type)) {
+					resolved = false;
+					break;
+				}
+				condData.functionData.params[i] = std::bit_cast<void*>(value);
 			}
 		}
-		//opcodes
-		switch (string::const_hash(opCode.str())) {
-		case "=="_h:
-			condData.flags.opCode = OP_CODE::kEqualTo;
-			break;
-		case "!="_h:
-			condData.flags.opCode = OP_CODE::kNotEqualTo;
-			break;
-		case ">"_h:
-			condData.flags.opCode = OP_CODE::kGreaterThan;
-			break;
-		case ">="_h:
-			condData.flags.opCode = OP_CODE::kGreaterThanOrEqualTo;
-			break;
-		case "<"_h:
-			condData.flags.opCode = OP_CODE::kLessThan;
-			break;
-		case "<="_h:
-			condData.flags.opCode = OP_CODE::kLessThanOrEqualTo;
-			break;
-		default:
+		if (!resolved) {
 			continue;
 		}
+		//opcodes
+		condData.flags.opCode = item.opCode;
 		// value
-		condData.comparisonValue.f = string::to_num<float>(value.str());
+		condData.comparisonValue.f = item.value;
 		// andOr
-		condData.flags.isOR = string::iequals(andOR.str(), "OR"sv);
+		condData.flags.isOR = item.isOR;
 
 		auto newNode = new RE::TESConditionItem;
 		newNode->data = condData;
 		newNode->next = nullptr;
 
-		auto* current = conditionPtr->head;
-		if (conditionPtr->head == nullptr) {
-			conditionPtr->head = newNode;
-		} else {
-			while (current->next != nullptr) {
-				current = current->next;
-			}
-			current->next = newNode;
+		*tail = newNode;
+		tail = &newNode->next;
+	}
+
+	return conditionPtr->head ? std::move(conditionPtr) : nullptr;
+}
+
+bool ConditionParser::IsGlobalFunction(FUNC_ID a_funcID)
+{
+	switch (a_funcID) {
+	case FUNC_ID::kGetGlobalValue:
+	case FUNC_ID::kGetCurrentTime:
+	case FUNC_ID::kGetDayOfWeek:
+	case FUNC_ID::kIsTimePassing:
+	case FUNC_ID::kGetRealHoursPassed:
+	case FUNC_ID::kMenuMode:
+	case FUNC_ID::kIsRaining:
+	case FUNC_ID::kIsSnowing:
+	case FUNC_ID::kIsPleasant:
+	case FUNC_ID::kIsCloudy:
+	case FUNC_ID::kGetWindSpeed:
+	case FUNC_ID::kGetCurrentWeatherPercent:
+	case FUNC_ID::kGetIsCurrentWeather:
+	case FUNC_ID::kGetStage:
+	case FUNC_ID::kGetStageDone:
+	case FUNC_ID::kGetQuestRunning:
+	case FUNC_ID::kGetQuestCompleted:
+	case FUNC_ID::kGetQuestVariable:
+	case FUNC_ID::kGetVMQuestVariable:
+	case FUNC_ID::kGetLocationCleared:
+	case FUNC_ID::kIsLocationLoaded:
+	case FUNC_ID::kGetPCIsClass:
+	case FUNC_ID::kGetPCIsRace:
+	case FUNC_ID::kGetPCIsSex:
+	case FUNC_ID::kGetPCInFaction:
+	case FUNC_ID::kGetPCExpelled:
+	case FUNC_ID::kGetPCFactionMurder:
+	case FUNC_ID::kGetPCEnemyofFaction:
+	case FUNC_ID::kGetPCFactionAttack:
+	case FUNC_ID::kGetPCMiscStat:
+	case FUNC_ID::kIsPCSleeping:
+	case FUNC_ID::kIsPCAMurderer:
+	case FUNC_ID::kIsPC1stPerson:
+	case FUNC_ID::kGetPlayerControlsDisabled:
+	case FUNC_ID::kIsPlayerInRegion:
+	case FUNC_ID::kIsPlayerMovingIntoNewSpace:
+	case FUNC_ID::kGetPlayerTeammateCount:
+		return true;
+	default:
+		return false;
+	}
+}
+
+ConditionParser::Scope ConditionParser::GetScope(const RE::TESCondition& a_condition)
+{
+	auto scope = Scope::kGlobal;
+
+	for (auto item = a_condition.head; item; item = item->next) {
+		const auto funcID = *item->data.functionData.function;
+		if (funcID == FUNC_ID::kGetRandomPercent) {
+			return Scope::kVolatile;
 		}
+		if (item->data.object != RE::CONDITIONITEMOBJECT::kRef && !IsGlobalFunction(funcID)) {
+			scope = Scope::kSubject;
+		}
+	}
 
-		addedCondition = true;
+	return scope;
+}
+
+ConditionParser::Dependencies ConditionParser::GetDependencies(const RE::TESCondition& a_condition)
+{
+	Dependencies dependencies;
+
+	for (auto item = a_condition.head; item; item = item->next) {
+		const auto& data = item->data;
+		if (data.flags.global && data.comparisonValue.g) {
+			dependencies.globals.emplace(data.comparisonValue.g);
+		}
+
+		const auto param = static_cast<const RE::TESForm*>(data.functionData.params[0]);
+		switch (*data.functionData.function) {
+		case FUNC_ID::kGetGlobalValue:
+			if (param) {
+				dependencies.globals.emplace(param);
+			}
+			break;
+		case FUNC_ID::kGetStage:
+		case FUNC_ID::kGetStageDone:
+		case FUNC_ID::kGetQuestRunning:
+		case FUNC_ID::kGetQuestCompleted:
+			if (param) {
+				dependencies.quests.emplace(param->GetFormID());
+			}
+			break;
+		case FUNC_ID::kGetCurrentTime:
+		case FUNC_ID::kGetDayOfWeek:
+			dependencies.time = true;
+			break;
+		case FUNC_ID::kIsRaining:
+		case FUNC_ID::kIsSnowing:
+		case FUNC_ID::kIsPleasant:
+		case FUNC_ID::kIsCloudy:
+		case FUNC_ID::kGetWindSpeed:
+		case FUNC_ID::kGetCurrentWeatherPercent:
+		case FUNC_ID::kGetIsCurrentWeather:
+			dependencies.weather = true;
+			break;
+		default:
+			break;
+		}
 	}
 
-	return addedCondition ? std::move(conditionPtr) : nullptr;
+	return dependencies;
 }
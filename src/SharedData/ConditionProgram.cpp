@@ -0,0 +1,127 @@
+#include "ConditionProgram.h"
+
+#include "ConditionParser.h"
+
+namespace
+{
+	ConditionEvaluator::OpCode to_op_code(OP_CODE a_opCode)
+	{
+		switch (a_opCode) {
+		case OP_CODE::kNotEqualTo:
+			return ConditionEvaluator::OpCode::kNotEqualTo;
+		case OP_CODE::kGreaterThan:
+			return ConditionEvaluator::OpCode::kGreaterThan;
+		case OP_CODE::kGreaterThanOrEqualTo:
+			return ConditionEvaluator::OpCode::kGreaterThanOrEqualTo;
+		case OP_CODE::kLessThan:
+			return ConditionEvaluator::OpCode::kLessThan;
+		case OP_CODE::kLessThanOrEqualTo:
+			return ConditionEvaluator::OpCode::kLessThanOrEqualTo;
+		default:
+			return ConditionEvaluator::OpCode::kEqualTo;
+		}
+	}
+}
+
+ConditionProgram::ConditionProgram(const RE::TESCondition& a_condition)
+{
+	for (auto item = a_condition.head; item; item = item->next) {
+		const auto& data = item->data;
+
+		Instruction instruction{
+			.opCode = to_op_code(data.flags.opCode),
+			.isOR = data.flags.isOR,
+			.value = data.comparisonValue.f,
+			.item = ToHandle(item)
+		};
+
+		// native functions run on the subject passed to Evaluate, anything bound to another ref or comparing against a global goes through the engine
+		const auto param = static_cast<const RE::TESForm*>(data.functionData.params[0]);
+		const bool onSubject = data.object == RE::CONDITIONITEMOBJECT::kSelf;
+
+		if (!data.flags.global) {
+			switch (*data.functionData.function) {
+			case FUNC_ID::kGetGlobalValue:
+				if (param && param->Is(RE::FormType::Global)) {
+					instruction.op = Op::kGetGlobalValue;
+					instruction.form = ToHandle(param);
+				}
+				break;
+			case FUNC_ID::kGetCurrentTime:
+				instruction.op = Op::kGetCurrentTime;
+				break;
+			case FUNC_ID::kIsInInterior:
+				if (onSubject) {
+					instruction.op = Op::kIsInInterior;
+				}
+				break;
+			case FUNC_ID::kGetInCell:
+				if (onSubject && param && param->Is(RE::FormType::Cell)) {
+					instruction.op = Op::kGetInCell;
+					instruction.form = ToHandle(param);
+				}
+				break;
+			case FUNC_ID::kGetInWorldspace:
+				// form lists go through the engine
+				if (onSubject && param && param->Is(RE::FormType::WorldSpace)) {
+					instruction.op = Op::kGetInWorldspace;
+					instruction.form = ToHandle(param);
+				}
+				break;
+			case FUNC_ID::kHasKeyword:
+				if (onSubject && param && param->Is(RE::FormType::Keyword)) {
+					instruction.op = Op::kHasKeyword;
+					instruction.form = ToHandle(param);
+				}
+				break;
+			default:
+				break;
+			}
+		}
+
+		instructions.push_back(instruction);
+	}
+}
+
+std::size_t ConditionProgram::GetNativeCount() const
+{
+	return std::ranges::count_if(instructions, [](const auto& instruction) { return instruction.op != Op::kFallback; });
+}
+
+float ConditionProgram::GameState::GetGlobalValue(ConditionEvaluator::Form a_global) const
+{
+	return FromHandle<const RE::TESGlobal>(a_global)->value;
+}
+
+float ConditionProgram::GameState::GetCurrentTime() const
+{
+	return RE::Calendar::GetSingleton()->GetHour();
+}
+
+bool ConditionProgram::GameState::IsInInterior(ConditionEvaluator::Subject a_ref) const
+{
+	const auto cell = FromHandle<RE::TESObjectREFR>(a_ref)->GetParentCell();
+	return cell && cell->IsInteriorCell();
+}
+
+ConditionEvaluator::Form ConditionProgram::GameState::GetParentCell(ConditionEvaluator::Subject a_ref) const
+{
+	return ToHandle(FromHandle<RE::TESObjectREFR>(a_ref)->GetParentCell());
+}
+
+ConditionEvaluator::Form ConditionProgram::GameState::GetWorldspace(ConditionEvaluator::Subject a_ref) const
+{
+	return ToHandle(FromHandle<RE::TESObjectREFR>(a_ref)->GetWorldspace());
+}
+
+bool ConditionProgram::GameState::HasKeyword(ConditionEvaluator::Subject a_ref, ConditionEvaluator::Form a_keyword) const
+{
+	return FromHandle<RE::TESObjectREFR>(a_ref)->HasKeyword(FromHandle<const RE::BGSKeyword>(a_keyword));
+}
+
+bool ConditionProgram::GameState::IsTrue(ConditionEvaluator::Item a_item, ConditionEvaluator::Subject a_ref) const
+{
+	const auto               ref = FromHandle<RE::TESObjectREFR>(a_ref);
+	RE::ConditionCheckParams params(ref, ref);
+	return FromHandle<RE::TESConditionItem>(a_item)->IsTrue(params);
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "SharedData/ConditionEvaluator.h"
+
+// TESCondition lowered to a flat instruction list. Cheap, common functions are evaluated natively,
+// everything else falls back to the item's own IsTrue.
+class ConditionProgram
+{
+public:
+	using Op = ConditionEvaluator::Op;
+	using Instruction = ConditionEvaluator::Instruction;
+
+	// everything the evaluator reads from the game, through the handles the program was built with
+	// Evaluate can be instantiated with any type exposing the same members
+	struct GameState
+	{
+		float                    GetGlobalValue(ConditionEvaluator::Form a_global) const;
+		float                    GetCurrentTime() const;
+		bool                     IsInInterior(ConditionEvaluator::Subject a_ref) const;
+		ConditionEvaluator::Form GetParentCell(ConditionEvaluator::Subject a_ref) const;
+		ConditionEvaluator::Form GetWorldspace(ConditionEvaluator::Subject a_ref) const;
+		bool                     HasKeyword(ConditionEvaluator::Subject a_ref, ConditionEvaluator::Form a_keyword) const;
+		bool                     IsTrue(ConditionEvaluator::Item a_item, ConditionEvaluator::Subject a_ref) const;
+	};
+
+	ConditionProgram() = default;
+	explicit ConditionProgram(const RE::TESCondition& a_condition);
+
+	template <class State = GameState>
+	bool Evaluate(RE::TESObjectREFR* a_subject, const State& a_state = {}) const
+	{
+		return ConditionEvaluator::Evaluate(instructions, ToHandle(a_subject), a_state);
+	}
+
+	[[nodiscard]] bool        empty() const { return instructions.empty(); }
+	[[nodiscard]] std::size_t GetNativeCount() const;
+
+private:
+	static ConditionEvaluator::Form    ToHandle(const RE::TESForm* a_form) { return reinterpret_cast<ConditionEvaluator::Form>(a_form); }
+	static ConditionEvaluator::Item    ToHandle(RE::TESConditionItem* a_item) { return reinterpret_cast<ConditionEvaluator::Item>(a_item); }
+	static ConditionEvaluator::Subject ToHandle(RE::TESObjectREFR* a_ref) { return reinterpret_cast<ConditionEvaluator::Subject>(a_ref); }
+
+	template <class T>
+	static T* FromHandle(auto a_handle)
+	{
+		return static_cast<T*>(const_cast<void*>(static_cast<const void*>(a_handle)));
+	}
+
+	// members
+	std::vector<Instruction> instructions;
+};
@@ -139,7 +139,7 @@ namespace Extra
 			requires std::is_same_v<RE::FormID, T>
 			:
 			reference(RE::GetFormID(other.reference)),
-			keyword(RE::GetFormID(other.keyword))
+			keyword(RE::GetKeywordFormID(other.keyword))
 		{}
 
 		bool none() const { return reference == 0; }
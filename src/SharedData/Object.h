@@ -29,6 +29,23 @@ namespace Base
 		GENERATE_HASH(MotionType, a_val.type, a_val.allowActivate)
 	};
 
+	// per base data needed at spawn time, resolved once alongside the base
+	struct BoundData
+	{
+		BoundData() = default;
+		explicit BoundData(const RE::TESBoundObject* a_base) :
+			extents(
+				static_cast<float>(a_base->boundData.boundMax.x - a_base->boundData.boundMin.x),
+				static_cast<float>(a_base->boundData.boundMax.y - a_base->boundData.boundMin.y),
+				static_cast<float>(a_base->boundData.boundMax.z - a_base->boundData.boundMin.z)),
+			canBeMoved(RE::CanBeMoved(a_base))
+		{}
+
+		// members
+		RE::NiPoint3 extents{};
+		bool         canBeMoved{ false };
+	};
+
 	template <class T>
 	struct WeightedObjects
 	{
@@ -36,12 +53,16 @@ namespace Base
 		{
 			kNone = 0,
 			kEqualWeights = 1 << 0,
+			kAliasTable = 1 << 1,
 		};
 
 		WeightedObjects() = default;
 		WeightedObjects(const WeightedObjects& other) :
 			objects(other.objects),
 			weights(other.weights),
+			bounds(other.bounds),
+			aliasProbs(other.aliasProbs),
+			aliases(other.aliases),
 			flags(other.flags)
 		{}
 
@@ -75,6 +96,9 @@ namespace Base
 		{
 			objects.reserve(a_count);
 			weights.reserve(a_count);
+			if constexpr (std::is_same_v<RE::TESBoundObject*, T>) {
+				bounds.reserve(a_count);
+			}
 		}
 
 		void emplace_back(const std::string& a_base, float a_weight)
@@ -89,11 +113,67 @@ namespace Base
 		{
 			objects.emplace_back(a_base);
 			weights.emplace_back(a_weight);
+			bounds.emplace_back(a_base);
+		}
+
+		// Vose's alias method, so weighted picks don't rebuild a distribution per sample
+		void build_alias_table()
+		{
+			const auto count = static_cast<std::uint32_t>(weights.size());
+			if (count == 0 || flags.any(Flags::kEqualWeights)) {
+				return;
+			}
+
+			const float total = std::reduce(weights.begin(), weights.end(), 0.0f);
+			if (total <= 0.0f) {
+				return;
+			}
+
+			aliasProbs.assign(count, 1.0f);
+			aliases.resize(count);
+			std::iota(aliases.begin(), aliases.end(), 0);
+
+			std::vector<float>         scaled(count);
+			std::vector<std::uint32_t> small;
+			std::vector<std::uint32_t> large;
+			for (std::uint32_t i = 0; i < count; i++) {
+				scaled[i] = weights[i] * count / total;
+				(scaled[i] < 1.0f ? small : large).push_back(i);
+			}
+
+			while (!small.empty() && !large.empty()) {
+				const auto less = small.back();
+				small.pop_back();
+				const auto more = large.back();
+
+				aliasProbs[less] = scaled[less];
+				aliases[less] = more;
+
+				scaled[more] = (scaled[more] + scaled[less]) - 1.0f;
+				if (scaled[more] < 1.0f) {
+					large.pop_back();
+					small.push_back(more);
+				}
+			}
+			// leftovers are 1.0 up to float error
+
+			flags.set(Flags::kAliasTable);
+		}
+
+		std::uint32_t sample_alias(std::size_t a_seed) const
+		{
+			clib_util::RNG rng(a_seed);
+
+			const auto column = rng.generate<std::uint32_t>(0, static_cast<std::uint32_t>(aliasProbs.size()) - 1);
+			return rng.generate(0.0f, 1.0f) < aliasProbs[column] ? column : aliases[column];
 		}
 
 		// members
 		std::vector<T>                     objects{};
 		std::vector<float>                 weights{};
+		std::vector<BoundData>             bounds{};  // parallel to objects, only filled for resolved bases
+		std::vector<float>                 aliasProbs{};
+		std::vector<std::uint32_t>         aliases{};
 		REX::EnumSet<Flags, std::uint32_t> flags{ Flags::kNone };
 
 	private:
@@ -14,23 +14,35 @@ namespace BSScript
 		std::vector<bool>           // kBoolArray
 		>;
 
+	// form property, handle is fetched once when configs are resolved
+	struct ObjectValue
+	{
+		RE::VMHandle handle{ 0 };
+	};
+
+	// array contents built once when configs are resolved, copied into a fresh VM array per spawn
+	struct ArrayValue
+	{
+		RE::BSScript::TypeInfo::RawType     type{ RE::BSScript::TypeInfo::RawType::kNone };
+		std::vector<RE::BSScript::Variable> values;   // scalar elements
+		std::vector<RE::VMHandle>           handles;  // object elements
+	};
+
 	using GameValue = std::variant<
-		std::monostate,             // kNone
-		RE::BSFixedString,          // kString
-		RE::TESForm*,               // kObject
-		std::int32_t,               // kInt
-		float,                      // kFloat
-		bool,                       // kBool
-		std::vector<RE::TESForm*>,  // kObjectArray
-		std::vector<std::string>,   // StringArray
-		std::vector<std::int32_t>,  // kIntArray
-		std::vector<float>,         // kFloatArray
-		std::vector<bool>           // kBoolArray
+		std::monostate,     // kNone
+		RE::BSFixedString,  // kString
+		ObjectValue,        // kObject
+		std::int32_t,       // kInt
+		float,              // kFloat
+		bool,               // kBool
+		ArrayValue          // k*Array
 		>;
 
 	template <class T>
 	struct Script
 	{
+		using Name = std::conditional_t<std::is_same_v<T, GameValue>, RE::BSFixedString, std::string>;
+
 		Script() = default;
 		Script(const Script<T>& other) :
 			script(other.script),
@@ -44,6 +56,12 @@ namespace BSScript
 			script(a_config.script),
 			autoFillProperties(a_config.autoFillProperties)
 		{
+			auto* handlePolicy = RE::BSScript::Internal::VirtualMachine::GetSingleton()->GetObjectHandlePolicy();
+
+			const auto get_handle = [&](const RE::TESForm* a_form) -> RE::VMHandle {
+				return handlePolicy ? handlePolicy->GetHandleForObject(a_form->GetFormType(), a_form) : 0;
+			};
+
 			properties.reserve(a_config.properties.size());
 			for (const auto& [propName, prop] : a_config.properties) {
 				GameValue gameValue;
@@ -51,30 +69,57 @@ namespace BSScript
 							   [&](std::monostate) {},
 							   [&](const std::string& a_val) {
 								   if (auto form = RE::GetForm(a_val); form) {
-									   gameValue = form;
+									   if (const auto handle = get_handle(form)) {
+										   gameValue = ObjectValue{ handle };
+									   }
 								   } else {
-									   gameValue = a_val;
+									   gameValue = RE::BSFixedString(a_val);
 								   }
 							   },
 							   [&](const std::vector<std::string>& a_val) {
+								   ArrayValue arr;
 								   if (auto form = !a_val.empty() ? RE::GetForm(a_val[0]) : nullptr; form) {
-									   std::vector<RE::TESForm*> forms;
-									   forms.push_back(form);
+									   arr.type = RE::BSScript::TypeInfo::RawType::kObject;
+									   arr.handles.push_back(get_handle(form));
 									   for (auto& str : std::ranges::drop_view{ a_val, 1 }) {
 										   if (form = RE::GetForm(str); form) {
-											   forms.push_back(form);
+											   arr.handles.push_back(get_handle(form));
 										   }
 									   }
-									   gameValue = forms;
 								   } else {
-									   gameValue = a_val;
+									   arr.type = RE::BSScript::TypeInfo::RawType::kString;
+									   for (auto& str : a_val) {
+										   arr.values.emplace_back().SetString(str);
+									   }
+								   }
+								   gameValue = std::move(arr);
+							   },
+							   [&](const std::vector<std::int32_t>& a_val) {
+								   ArrayValue arr{ .type = RE::BSScript::TypeInfo::RawType::kInt };
+								   for (auto val : a_val) {
+									   arr.values.emplace_back().SetSInt(val);
 								   }
+								   gameValue = std::move(arr);
+							   },
+							   [&](const std::vector<float>& a_val) {
+								   ArrayValue arr{ .type = RE::BSScript::TypeInfo::RawType::kFloat };
+								   for (auto val : a_val) {
+									   arr.values.emplace_back().SetFloat(val);
+								   }
+								   gameValue = std::move(arr);
+							   },
+							   [&](const std::vector<bool>& a_val) {
+								   ArrayValue arr{ .type = RE::BSScript::TypeInfo::RawType::kBool };
+								   for (bool val : a_val) {
+									   arr.values.emplace_back().SetBool(val);
+								   }
+								   gameValue = std::move(arr);
 							   },
 							   [&](const auto& a_val) {
 								   gameValue = a_val;
 							   } },
 					prop);
-				properties.emplace_back(propName, gameValue);
+				properties.emplace_back(propName, std::move(gameValue));
 			}
 		}
 
@@ -83,9 +128,75 @@ namespace BSScript
 			return script == a_rhs.script;
 		}
 
-		std::string                            script;
-		std::vector<std::pair<std::string, T>> properties;
-		bool                                   autoFillProperties{ true };
+		// sets every configured property on a freshly created script object
+		void BindProperties(RE::BSScript::Object* a_object, RE::BSScript::Internal::VirtualMachine* a_vm, RE::BSScript::ObjectBindPolicy* a_bindPolicy) const
+			requires std::is_same_v<T, GameValue>
+		{
+			for (const auto& [propName, property] : properties) {
+				auto propInfo = a_object->GetProperty(propName);
+				if (!propInfo) {
+					continue;
+				}
+				std::visit(overload{
+							   [&](std::monostate) {},
+							   [&](const RE::BSFixedString& a_val) {
+								   propInfo->SetString(a_val);
+							   },
+							   [&](const ObjectValue& a_val) {
+								   BindHandle(propInfo, a_val.handle, a_vm, a_bindPolicy);
+							   },
+							   [&](const std::int32_t& a_val) {
+								   propInfo->SetSInt(a_val);
+							   },
+							   [&](const float& a_val) {
+								   propInfo->SetFloat(a_val);
+							   },
+							   [&](const bool& a_val) {
+								   propInfo->SetBool(a_val);
+							   },
+							   [&](const ArrayValue& a_val) {
+								   BindArray(propInfo, a_val, a_vm, a_bindPolicy);
+							   } },
+					property);
+			}
+		}
+
+		void BindHandle(RE::BSScript::Variable* a_variable, RE::VMHandle a_handle, RE::BSScript::Internal::VirtualMachine* a_vm, RE::BSScript::ObjectBindPolicy* a_bindPolicy) const
+			requires std::is_same_v<T, GameValue>
+		{
+			RE::BSTSmartPointer<RE::BSScript::Object> obj;
+			if (a_handle && a_bindPolicy && a_vm->CreateObject(script, obj) && obj) {
+				a_bindPolicy->BindObject(obj, a_handle);
+				a_variable->SetObject(obj);
+			}
+		}
+
+		void BindArray(RE::BSScript::Variable* a_variable, const ArrayValue& a_val, RE::BSScript::Internal::VirtualMachine* a_vm, RE::BSScript::ObjectBindPolicy* a_bindPolicy) const
+			requires std::is_same_v<T, GameValue>
+		{
+			const bool isObject = a_val.type == RE::BSScript::TypeInfo::RawType::kObject;
+			const auto size = static_cast<std::uint32_t>(isObject ? a_val.handles.size() : a_val.values.size());
+
+			RE::BSTSmartPointer<RE::BSScript::Array> arr;
+			if (!a_vm->CreateArray(a_val.type, size, arr) || !arr) {
+				return;
+			}
+
+			if (isObject) {
+				for (std::uint32_t i = 0; i < size; i++) {
+					BindHandle(std::addressof(arr->data()[i]), a_val.handles[i], a_vm, a_bindPolicy);
+				}
+			} else {
+				std::ranges::copy(a_val.values, arr->data());
+			}
+
+			a_variable->SetArray(arr);
+		}
+
+		// members
+		Name                            script;
+		std::vector<std::pair<Name, T>> properties;
+		bool                            autoFillProperties{ true };
 
 	private:
 		GENERATE_HASH(Script<T>, a_val.script, a_val.properties, a_val.autoFillProperties)
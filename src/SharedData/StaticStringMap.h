@@ -0,0 +1,60 @@
+#pragma once
+
+// immutable string_view -> value table, built at compile time with FNV-1a and linear probing at half load
+template <class V, std::size_t N>
+class StaticStringMap
+{
+public:
+	using value_type = std::pair<std::string_view, V>;
+
+	consteval explicit StaticStringMap(const std::array<value_type, N>& a_entries) :
+		entries(a_entries)
+	{
+		for (std::size_t i = 0; i < N; ++i) {
+			auto slot = hash(entries[i].first) & mask;
+			while (slots[slot] != 0) {
+				if (entries[slots[slot] - 1].first == entries[i].first) {
+					throw "duplicate key in StaticStringMap";
+				}
+				slot = (slot + 1) & mask;
+			}
+			slots[slot] = static_cast<std::uint16_t>(i + 1);
+		}
+	}
+
+	[[nodiscard]] constexpr const V* find(std::string_view a_key) const
+	{
+		for (auto slot = hash(a_key) & mask; slots[slot] != 0; slot = (slot + 1) & mask) {
+			if (const auto& [key, value] = entries[slots[slot] - 1]; key == a_key) {
+				return &value;
+			}
+		}
+		return nullptr;
+	}
+
+	[[nodiscard]] constexpr bool contains(std::string_view a_key) const { return find(a_key) != nullptr; }
+
+	[[nodiscard]] constexpr const auto& data() const { return entries; }
+
+private:
+	static constexpr std::size_t capacity = std::bit_ceil(N * 2);
+	static constexpr std::size_t mask = capacity - 1;
+
+	static_assert(N < std::numeric_limits<std::uint16_t>::max());
+
+	static constexpr std::uint32_t hash(std::string_view a_str)
+	{
+		std::uint32_t result = 2166136261u;
+		for (const auto ch : a_str) {
+			result = (result ^ static_cast<std::uint8_t>(ch)) * 16777619u;
+		}
+		return result;
+	}
+
+	// members
+	std::array<value_type, N>           entries{};
+	std::array<std::uint16_t, capacity> slots{};  // entry index + 1, 0 is empty
+};
+
+template <class V, std::size_t N>
+StaticStringMap(const std::array<std::pair<std::string_view, V>, N>&) -> StaticStringMap<V, N>;
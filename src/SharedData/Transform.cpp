@@ -47,24 +47,49 @@ namespace RE
 		return std::tie(rotate, translate, scale) == std::tie(a_rhs.rotate, a_rhs.translate, a_rhs.scale);
 	}
 
-	void BSTransform::ValidatePosition(TESObjectCELL* a_cell, TESObjectREFR* a_ref, const BoundingBox& a_refBB, const NiPoint3& a_spawnExtents)
+	ClipRaycaster::ClipRaycaster(TESObjectCELL* a_cell, TESObjectREFR* a_ref, const BoundingBox& a_refBB) :
+		world(a_cell ? a_cell->GetbhkWorld() : nullptr),
+		ref(a_ref),
+		refBB(a_refBB),
+		rayStart(a_refBB.pos)
 	{
-		if (!a_cell) {
-			return;
+		rayStart.z += a_refBB.extents.z;
+	}
+
+	bool ClipRaycaster::IsIgnored(const hkpCollidable* a_collidable)
+	{
+		if (const auto layer = a_collidable->GetCollisionLayer(); layer == COL_LAYER::kBiped ||
+																  layer == COL_LAYER::kDeadBip ||
+																  layer == COL_LAYER::kClutter ||
+																  layer == COL_LAYER::kProjectile ||
+																  layer == COL_LAYER::kSpell ||
+																  layer == COL_LAYER::kWeapon ||
+																  layer == COL_LAYER::kCloudTrap) {
+			return true;
 		}
 
-		const auto bhkWorld = a_cell->GetbhkWorld();
-		if (!bhkWorld) {
-			return;
+		if (const auto it = ignoredCollidables.find(a_collidable); it != ignoredCollidables.end()) {
+			return it->second;
 		}
 
-		const static auto worldScale = RE::bhkWorld::GetWorldScale();
-		const NiPoint3    scaledExtents = a_spawnExtents * scale;
+		auto       hitRef = TESHavokUtilities::FindCollidableRef(*a_collidable);
+		const bool ignored = hitRef && (hitRef == ref || IsInBoundingBox(hitRef->GetPosition(), refBB.boundMin, refBB.boundMax));
 
-		NiPoint3 rayStart = a_refBB.pos;
-		rayStart.z += a_refBB.extents.z;
+		ignoredCollidables.emplace(a_collidable, ignored);
+
+		return ignored;
+	}
+
+	bool ClipRaycaster::ValidatePosition(BSTransform& a_transform, const NiPoint3& a_spawnExtents)
+	{
+		if (!world) {
+			return false;
+		}
+
+		const static auto worldScale = RE::bhkWorld::GetWorldScale();
+		const NiPoint3    scaledExtents = a_spawnExtents * a_transform.scale;
 
-		const NiPoint3 rayEnd = translate;
+		const NiPoint3 rayEnd = a_transform.translate;
 		const NiPoint3 rayVec = rayEnd - rayStart;
 
 		hkpAllRayHitTempCollector collector;
@@ -76,55 +101,43 @@ namespace RE
 		pick.rayInput.filterInfo.SetCollisionLayer(COL_LAYER::kLOS);
 		pick.allRayHitTempCollector = &collector;
 
-		if (bhkWorld->PickObject(pick)) {
-			float                        minFraction = 1.0f;
-			const hkpWorldRayCastOutput* bestHit = nullptr;
-
-			for (const auto& hit : collector.hits) {
-				if (hit.hitFraction >= minFraction) {
-					continue;
-				}
-
-				if (!hit.rootCollidable) {
-					continue;
-				}
-
-				if (const auto layer = hit.rootCollidable->GetCollisionLayer(); layer == COL_LAYER::kBiped ||
-																				layer == COL_LAYER::kDeadBip ||
-																				layer == COL_LAYER::kClutter ||
-																				layer == COL_LAYER::kProjectile ||
-																				layer == COL_LAYER::kSpell ||
-																				layer == COL_LAYER::kWeapon ||
-																				layer == COL_LAYER::kCloudTrap) {
-					continue;
-				}
-
-				auto hitRef = TESHavokUtilities::FindCollidableRef(*hit.rootCollidable);
-				if (hitRef && (hitRef == a_ref || IsInBoundingBox(hitRef->GetPosition(), a_refBB.boundMin, a_refBB.boundMax))) {
-					continue;
-				}
-
-				minFraction = hit.hitFraction;
-				bestHit = &hit;
+		if (!world->PickObject(pick)) {
+			return true;
+		}
+
+		// nearest first, so the first usable hit is the closest one
+		sortedHits.clear();
+		for (const auto& hit : collector.hits) {
+			if (hit.rootCollidable) {
+				sortedHits.push_back(&hit);
 			}
+		}
+		std::ranges::sort(sortedHits, {}, &hkpWorldRayCastOutput::hitFraction);
 
-			if (bestHit) {
-				NiPoint3 normal{
-					bestHit->normal.quad.m128_f32[0],
-					bestHit->normal.quad.m128_f32[1],
-					bestHit->normal.quad.m128_f32[2]
-				};
+		const auto bestHit = std::ranges::find_if(sortedHits, [&](const auto* a_hit) {
+			return !IsIgnored(a_hit->rootCollidable);
+		});
 
-				NiMatrix3 rot(rotate);
+		if (bestHit != sortedHits.end()) {
+			const auto* hit = *bestHit;
 
-				const float projectedDepth =
-					(std::abs(normal.Dot(rot.GetVectorX())) * scaledExtents.x) +
-					(std::abs(normal.Dot(rot.GetVectorY())) * scaledExtents.y) +
-					(std::abs(normal.Dot(rot.GetVectorZ())) * scaledExtents.z);
+			NiPoint3 normal{
+				hit->normal.quad.m128_f32[0],
+				hit->normal.quad.m128_f32[1],
+				hit->normal.quad.m128_f32[2]
+			};
 
-				const NiPoint3 hitPos = rayStart + (rayVec * minFraction);
-				translate = hitPos + (normal * (projectedDepth + 1.0f));
-			}
+			NiMatrix3 rot(a_transform.rotate);
+
+			const float projectedDepth =
+				(std::abs(normal.Dot(rot.GetVectorX())) * scaledExtents.x) +
+				(std::abs(normal.Dot(rot.GetVectorY())) * scaledExtents.y) +
+				(std::abs(normal.Dot(rot.GetVectorZ())) * scaledExtents.z);
+
+			const NiPoint3 hitPos = rayStart + (rayVec * hit->hitFraction);
+			a_transform.translate = hitPos + (normal * (projectedDepth + 1.0f));
 		}
+
+		return true;
 	}
 }
@@ -99,8 +99,6 @@ namespace RE
 
 		bool operator==(const BSTransform& a_rhs) const;
 
-		void ValidatePosition(TESObjectCELL* a_cell, TESObjectREFR* a_ref, const BoundingBox& a_refBB, const RE::NiPoint3& a_spawnExtents);
-
 		// members
 		NiPoint3 rotate;
 		NiPoint3 translate;
@@ -112,6 +110,30 @@ namespace RE
 			a_val.translate,
 			a_val.scale)
 	};
+
+	// casts clipping rays outward from one parent reference
+	// colliders hit by earlier rays are remembered, so instances sharing a parent only resolve each one once
+	class ClipRaycaster
+	{
+	public:
+		ClipRaycaster(TESObjectCELL* a_cell, TESObjectREFR* a_ref, const BoundingBox& a_refBB);
+
+		bool IsFor(const TESObjectREFR* a_ref) const { return ref == a_ref; }
+
+		// returns false if no ray could be cast (no havok world)
+		bool ValidatePosition(BSTransform& a_transform, const NiPoint3& a_spawnExtents);
+
+	private:
+		bool IsIgnored(const hkpCollidable* a_collidable);
+
+		// members
+		bhkWorld*                                 world;
+		TESObjectREFR*                            ref;
+		BoundingBox                               refBB;
+		NiPoint3                                  rayStart;
+		FlatMap<const hkpCollidable*, bool>       ignoredCollidables;  // [collidable, belongs to parent]
+		std::vector<const hkpWorldRayCastOutput*> sortedHits;
+	};
 }
 
 namespace glz
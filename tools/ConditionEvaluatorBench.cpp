@@ -0,0 +1,196 @@
+// Times ConditionEvaluator against a mock game state, over programs shaped like the conditions objects use.
+// Each program is run as lowered, and again with every instruction left to the fallback, where the mock item
+// answers through an indirect call the way TESConditionItem::IsTrue dispatches through the function table.
+// Not part of the plugin build:
+//   g++ -std=c++23 -O2 -I../src/SharedData ConditionEvaluatorBench.cpp -o ConditionEvaluatorBench && ./ConditionEvaluatorBench
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "ConditionEvaluator.h"
+
+namespace
+{
+	using namespace ConditionEvaluator;
+
+	struct MockForm
+	{
+		float value{ 0.0f };  // globals only
+	};
+
+	struct MockRef
+	{
+		const MockForm*              cell{ nullptr };
+		const MockForm*              worldspace{ nullptr };
+		bool                         interior{ false };
+		std::vector<const MockForm*> keywords;
+	};
+
+	struct MockState;
+
+	struct MockItem
+	{
+		std::function<float(const MockState&, const MockRef&)> function;
+		OpCode                                                 opCode{ OpCode::kEqualTo };
+		float                                                  value{ 0.0f };
+	};
+
+	Form    to_handle(const MockForm* a_form) { return reinterpret_cast<Form>(a_form); }
+	Item    to_handle(MockItem* a_item) { return reinterpret_cast<Item>(a_item); }
+	Subject to_handle(MockRef* a_ref) { return reinterpret_cast<Subject>(a_ref); }
+
+	const MockForm* form(Form a_form) { return reinterpret_cast<const MockForm*>(a_form); }
+	const MockRef&  ref(Subject a_ref) { return *reinterpret_cast<const MockRef*>(a_ref); }
+
+	// same members as ConditionProgram::GameState
+	struct MockState
+	{
+		float GetGlobalValue(Form a_global) const { return form(a_global)->value; }
+		float GetCurrentTime() const { return hour; }
+		bool  IsInInterior(Subject a_ref) const { return ref(a_ref).interior; }
+		Form  GetParentCell(Subject a_ref) const { return to_handle(ref(a_ref).cell); }
+		Form  GetWorldspace(Subject a_ref) const { return to_handle(ref(a_ref).worldspace); }
+
+		bool HasKeyword(Subject a_ref, Form a_keyword) const
+		{
+			return std::ranges::find(ref(a_ref).keywords, form(a_keyword)) != ref(a_ref).keywords.end();
+		}
+
+		bool IsTrue(Item a_item, Subject a_ref) const
+		{
+			const auto& item = *reinterpret_cast<const MockItem*>(a_item);
+			return Compare(item.function(*this, ref(a_ref)), item.opCode, item.value);
+		}
+
+		// members
+		float hour{ 12.0f };
+	};
+
+	// the lowered instruction and the fallback item answering the same question
+	struct Condition
+	{
+		Instruction                                            instruction;
+		std::function<float(const MockState&, const MockRef&)> function;
+	};
+
+	struct Program
+	{
+		std::string_view       name;
+		std::vector<Condition> conditions;
+	};
+
+	struct Lowered
+	{
+		std::vector<Instruction> native;
+		std::vector<Instruction> fallback;
+		std::vector<MockItem>    items;
+	};
+
+	Lowered lower(const Program& a_program)
+	{
+		Lowered result;
+		result.items.reserve(a_program.conditions.size());
+		for (const auto& [instruction, function] : a_program.conditions) {
+			auto& item = result.items.emplace_back(function, instruction.opCode, instruction.value);
+
+			auto native = instruction;
+			native.item = to_handle(&item);
+			result.native.push_back(native);
+
+			auto fallback = native;
+			fallback.op = Op::kFallback;
+			result.fallback.push_back(fallback);
+		}
+		return result;
+	}
+
+	// average ns per evaluation over every subject, the true count keeps the work from being dropped
+	std::size_t time(const char* a_name, std::span<const Instruction> a_instructions, std::vector<MockRef>& a_refs, const MockState& a_state)
+	{
+		constexpr std::size_t passes = 200;
+
+		std::size_t trueCount = 0;
+		const auto  start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i < passes; ++i) {
+			for (auto& subject : a_refs) {
+				trueCount += Evaluate(a_instructions, to_handle(&subject), a_state);
+			}
+		}
+		const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+		std::printf("  %-9s %7.2f ns/evaluation\n", a_name, elapsed / static_cast<double>(passes * a_refs.size()));
+		return trueCount / passes;
+	}
+}
+
+int main()
+{
+	std::vector<MockForm> cells(64);
+	std::vector<MockForm> worldspaces(4);
+	std::vector<MockForm> keywords(16);
+	MockForm              global{ 1.0f };
+
+	std::mt19937 rng{ 42 };
+
+	std::vector<MockRef> refs(4096);
+	for (auto& subject : refs) {
+		subject.interior = rng() % 4 == 0;
+		subject.cell = &cells[rng() % cells.size()];
+		subject.worldspace = subject.interior ? nullptr : &worldspaces[rng() % worldspaces.size()];
+		for (std::size_t i = 0, count = rng() % 4; i < count; ++i) {
+			subject.keywords.push_back(&keywords[rng() % keywords.size()]);
+		}
+	}
+
+	const auto time_of_day = [](const MockState& a_state, const MockRef&) { return a_state.hour; };
+	const auto interior = [](const MockState&, const MockRef& a_ref) { return a_ref.interior ? 1.0f : 0.0f; };
+	const auto in_worldspace = [](const MockForm* a_worldspace) {
+		return [=](const MockState&, const MockRef& a_ref) { return a_ref.worldspace == a_worldspace ? 1.0f : 0.0f; };
+	};
+	const auto has_keyword = [](const MockForm* a_keyword) {
+		return [=](const MockState&, const MockRef& a_ref) { return std::ranges::find(a_ref.keywords, a_keyword) != a_ref.keywords.end() ? 1.0f : 0.0f; };
+	};
+	const auto global_value = [&](const MockState&, const MockRef&) { return global.value; };
+
+	const std::vector<Program> programs{
+		{ "daytime exterior",
+			{ { { Op::kGetCurrentTime, OpCode::kGreaterThanOrEqualTo, false, 6.0f }, time_of_day },
+				{ { Op::kGetCurrentTime, OpCode::kLessThan, false, 20.0f }, time_of_day },
+				{ { Op::kIsInInterior, OpCode::kEqualTo, false, 0.0f }, interior } } },
+		{ "worldspace or",
+			{ { { Op::kGetInWorldspace, OpCode::kEqualTo, true, 1.0f, to_handle(&worldspaces[0]) }, in_worldspace(&worldspaces[0]) },
+				{ { Op::kGetInWorldspace, OpCode::kEqualTo, true, 1.0f, to_handle(&worldspaces[1]) }, in_worldspace(&worldspaces[1]) },
+				{ { Op::kGetInWorldspace, OpCode::kEqualTo, false, 1.0f, to_handle(&worldspaces[2]) }, in_worldspace(&worldspaces[2]) } } },
+		{ "keywords and global",
+			{ { { Op::kHasKeyword, OpCode::kEqualTo, true, 1.0f, to_handle(&keywords[0]) }, has_keyword(&keywords[0]) },
+				{ { Op::kHasKeyword, OpCode::kEqualTo, false, 1.0f, to_handle(&keywords[1]) }, has_keyword(&keywords[1]) },
+				{ { Op::kGetGlobalValue, OpCode::kNotEqualTo, false, 0.0f, to_handle(&global) }, global_value } } },
+	};
+
+	const MockState state;
+
+	bool agree = true;
+	for (const auto& program : programs) {
+		const auto lowered = lower(program);
+
+		std::printf("%s\n", program.name.data());
+		const auto nativeTrue = time("native", lowered.native, refs, state);
+		const auto fallbackTrue = time("fallback", lowered.fallback, refs, state);
+		std::printf("  %zu of %zu subjects pass\n", nativeTrue, refs.size());
+
+		agree &= nativeTrue == fallbackTrue;
+	}
+
+	if (!agree) {
+		std::printf("native and fallback results disagree\n");
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,165 @@
+// Compares ConditionGrammar::Split against the regex BuildCondition used before the tokenizer, over a fixed corpus
+// and every combination of the fragments below. Not part of the plugin build:
+//   g++ -std=c++23 -I../src/SharedData ConditionGrammarCheck.cpp -o ConditionGrammarCheck && ./ConditionGrammarCheck
+// std::regex's default ECMAScript grammar backtracks the same way srell does.
+// With --bench it times both over the same conditions instead, build with -O2 for that.
+
+#include <array>
+#include <chrono>
+#include <cctype>
+#include <cstdio>
+#include <optional>
+#include <regex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std::literals;
+
+#include "ConditionGrammar.h"
+
+namespace
+{
+	const std::regex condRegex{ R"((\w+)?\s*(\w+)\s+(\w+)(?:\s+(\w+))?\s*([=!<>]+)\s*([\d.]+)\s*(AND|OR)?)" };
+
+	const std::vector<std::string> corpus{
+		"GetIsID 0x12EB7 == 1",
+		"GetIsID 0x12EB7 == 1 OR",
+		"GetIsID 0x12EB7 == 1 AND",
+		"PlayerRef GetIsID 0x7 == 1",
+		"PlayerRef GetActorValue Health >= 50.5 OR",
+		"Self GetInFaction 0x1BCC0 0 != 0 AND",
+		"IsRaining none == 1",
+		"A none == 1",
+		" IsRaining none == 1",
+		"\tGetStage MQ101 >= 10",
+		" GetVMQuestVariable MQ101 ::var == 1",
+		" GetQuestVariable MQ101 var 1 == 1",
+		"Target GetDistance PlayerRef < 100",
+		"GetLocked == 1",
+		"GetLocked",
+		"",
+		"   ",
+		"GetIsID 0x12EB7 = 1",
+		"GetIsID 0x12EB7 <> 1",
+		"GetIsID 0x12EB7 === 1",
+		"GetIsID 0x12EB7 == 1.2.3",
+		"GetIsID 0x12EB7 == .",
+		"GetIsID 0x12EB7 == -1",
+		"GetIsID 0x12EB7 ==1AND",
+		"GetIsID 0x12EB7==1",
+		"GetIsID 0x12EB7 == 1 and",
+		"GetIsID 0x12EB7 == 1 or",
+		"GetIsID 0x12EB7 == 1 AND ",
+		"GetIsID 0x12EB7 == 1 ",
+		"GetIsID 0x12EB7 == 1 2",
+		"GetIsID 0x12EB7 == 1 ANDOR",
+		"a b c d e == 1",
+		"a b c d == 1",
+		"GetIsID, 0x12EB7 == 1",
+		"GetIsID 0x12EB7 == 1 OR\n",
+		"été GetIsID 0x12EB7 == 1",
+	};
+
+	constexpr std::array lead{ ""sv, " "sv, "\t "sv };
+	constexpr std::array words{ ""sv, "S"sv, "Self"sv, "Self GetLocked"sv, "GetLocked x"sv, "Self GetLocked x"sv, "Self GetLocked x y"sv, "S G x y z"sv, "Self,GetLocked x"sv };
+	constexpr std::array ops{ ""sv, " == "sv, "=="sv, " <= "sv, " ! "sv };
+	constexpr std::array values{ ""sv, "1"sv, "0.5"sv, "1..2"sv, "x"sv };
+	constexpr std::array tails{ ""sv, " "sv, " AND"sv, "OR"sv, " OR "sv, " or"sv, " AND x"sv };
+
+	std::string_view group(const std::cmatch& a_match, std::size_t a_idx)
+	{
+		const auto& sub = a_match[a_idx];
+		return sub.matched ? std::string_view(sub.first, sub.second) : std::string_view{};
+	}
+
+	bool check(const std::string& a_condition)
+	{
+		std::cmatch match;
+		const bool  expected = std::regex_match(a_condition.c_str(), match, condRegex);
+
+		ConditionGrammar::Error error;
+		const auto              split = ConditionGrammar::Split(a_condition, error);
+
+		bool same = expected == split.has_value();
+		if (same && expected) {
+			same = group(match, 1) == split->subject &&
+			       group(match, 2) == split->function &&
+			       group(match, 3) == split->param1 &&
+			       group(match, 4) == split->param2 &&
+			       group(match, 5) == split->opCode &&
+			       group(match, 6) == split->value &&
+			       group(match, 7) == split->andOr;
+		}
+		if (!same) {
+			std::printf("mismatch: \"%s\" (regex %s, split %s)\n", a_condition.c_str(), expected ? "matched" : "failed", split ? "matched" : "failed");
+		}
+		return same;
+	}
+
+	std::vector<std::string> conditions()
+	{
+		std::vector<std::string> result(corpus.begin(), corpus.end());
+		for (const auto a : lead) {
+			for (const auto b : words) {
+				for (const auto c : ops) {
+					for (const auto d : values) {
+						for (const auto e : tails) {
+							result.push_back(std::string(a).append(b).append(c).append(d).append(e));
+						}
+					}
+				}
+			}
+		}
+		return result;
+	}
+
+	// average ns per condition over enough passes to run for a while, the match count keeps the work from being dropped
+	template <class F>
+	void time(const char* a_name, const std::vector<std::string>& a_conditions, F a_match)
+	{
+		constexpr std::size_t passes = 50;
+
+		std::size_t matched = 0;
+		const auto  start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i < passes; ++i) {
+			for (const auto& condition : a_conditions) {
+				matched += a_match(condition);
+			}
+		}
+		const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+		std::printf("%-8s %10.1f ns/condition (%zu matched)\n", a_name, elapsed / static_cast<double>(passes * a_conditions.size()), matched / passes);
+	}
+
+	int bench(const std::vector<std::string>& a_conditions)
+	{
+		time("regex", a_conditions, [](const std::string& a_condition) {
+			std::cmatch match;
+			return std::regex_match(a_condition.c_str(), match, condRegex);
+		});
+		time("split", a_conditions, [](const std::string& a_condition) {
+			ConditionGrammar::Error error;
+			return ConditionGrammar::Split(a_condition, error).has_value();
+		});
+		return 0;
+	}
+}
+
+int main(int a_argc, char** a_argv)
+{
+	const auto all = conditions();
+	if (a_argc > 1 && a_argv[1] == "--bench"sv) {
+		return bench(all);
+	}
+
+	std::size_t failed = 0;
+	for (const auto& condition : all) {
+		if (!check(condition)) {
+			++failed;
+		}
+	}
+
+	std::printf("%zu conditions checked, %zu mismatches\n", all.size(), failed);
+	return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,107 @@
+// Times the compile-time condition function tables against what they replaced: the StaticStringMap of function names
+// against a flat map built at startup, and the packed parameter type table against the switch it is generated from.
+// Not part of the plugin build:
+//   g++ -std=c++23 -O2 -I../src/SharedData ConditionLookupBench.cpp -o ConditionLookupBench && ./ConditionLookupBench
+// boost's flat map is used when its headers are found, std::unordered_map otherwise.
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#if __has_include(<boost/unordered/unordered_flat_map.hpp>)
+#	include <boost/unordered/unordered_flat_map.hpp>
+template <class K, class D>
+using FlatMap = boost::unordered_flat_map<K, D>;
+#else
+#	include <unordered_map>
+template <class K, class D>
+using FlatMap = std::unordered_map<K, D>;
+#endif
+
+using namespace std::literals;
+
+#include "ConditionFunctionsMock.h"
+
+#include "ConditionFunctions.h"
+
+namespace
+{
+	constexpr std::size_t passes = 2000;
+
+	// average ns per lookup, the sum keeps the work from being dropped
+	template <class T, class F>
+	std::uint64_t time(const char* a_name, const std::vector<T>& a_keys, F a_lookup)
+	{
+		std::uint64_t sum = 0;
+		const auto    start = std::chrono::steady_clock::now();
+		for (std::size_t i = 0; i < passes; ++i) {
+			for (const auto& key : a_keys) {
+				sum += a_lookup(key);
+			}
+		}
+		const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+		std::printf("%-16s %8.2f ns/lookup\n", a_name, elapsed / static_cast<double>(passes * a_keys.size()));
+		return sum;
+	}
+
+	std::uint64_t encode(const PARAMS& a_params)
+	{
+		const auto one = [](std::optional<PARAM_TYPE> a_type) { return a_type ? static_cast<std::uint64_t>(*a_type) + 1 : 0; };
+		return one(a_params.first) << 8 | one(a_params.second);
+	}
+}
+
+int main()
+{
+	std::mt19937 rng{ 42 };
+
+	// every function name once, and as many that miss
+	std::vector<std::string> names;
+	for (const auto& [name, id] : ConditionFunctions::ids.data()) {
+		names.emplace_back(name);
+		names.emplace_back(std::string(name).append("X"));
+	}
+	std::ranges::shuffle(names, rng);
+
+	FlatMap<std::string_view, std::uint16_t> flatMap;
+	for (const auto& [name, id] : ConditionFunctions::ids.data()) {
+		flatMap.emplace(name, id);
+	}
+
+	const auto staticSum = time("StaticStringMap", names, [](const std::string& a_name) -> std::uint64_t {
+		const auto id = ConditionFunctions::ids.find(a_name);
+		return id ? *id + 1 : 0;
+	});
+	const auto flatSum = time("FlatMap", names, [&](const std::string& a_name) -> std::uint64_t {
+		const auto it = flatMap.find(a_name);
+		return it != flatMap.end() ? it->second + 1 : 0;
+	});
+
+	// every ID up to the highest one, most of which take no parameters
+	std::vector<FUNC_ID> funcIDs;
+	for (const auto id : std::views::iota(0u, std::ranges::max(ConditionFunctions::ids.data() | std::views::values) + 1u)) {
+		funcIDs.push_back(static_cast<FUNC_ID>(id));
+	}
+	std::ranges::shuffle(funcIDs, rng);
+
+	const auto switchSum = time("switch", funcIDs, [](FUNC_ID a_id) { return encode(ConditionFunctions::get_func_type(a_id)); });
+	const auto packedSum = time("packed table", funcIDs, [](FUNC_ID a_id) { return encode(ConditionFunctions::GetParamTypes(a_id)); });
+
+	if (staticSum != flatSum || switchSum != packedSum) {
+		std::printf("lookups disagree\n");
+		return 1;
+	}
+	return 0;
+}